@@ -16,10 +16,12 @@ let package = Package(
   products: [
     // MMIO
     .library(name: "MMIO", targets: ["MMIO"]),
+    .library(name: "MMIOLinux", targets: ["MMIOLinux"]),
 
     // SVD
     .library(name: "SVD", targets: ["SVD"]),
     .library(name: "SVD2LLDB", type: .dynamic, targets: ["SVD2LLDB"]),
+    .executable(name: "SVDInspector", targets: ["SVDInspector"]),
     .executable(
       // FIXME: rdar://112530586
       // XPM skips build plugin if product and target names are not identical.
@@ -101,6 +103,16 @@ let package = Package(
 
     .systemLibrary(name: "MMIOVolatile"),
 
+    // Linux userspace mappings of device memory.
+    .target(
+      name: "MMIOLinux",
+      dependencies: ["MMIO", "MMIOLinuxShims"]),
+    .testTarget(
+      name: "MMIOLinuxTests",
+      dependencies: ["MMIO", "MMIOLinux", "MMIOLinuxShims"]),
+
+    .systemLibrary(name: "MMIOLinuxShims"),
+
     // SVD
     .target(
       name: "SVD",
@@ -123,6 +135,15 @@ let package = Package(
       dependencies: ["SVD2LLDB"],
       swiftSettings: [.interoperabilityMode(.Cxx)]),
 
+    .executableTarget(
+      name: "SVDInspector",
+      dependencies: [
+        .product(name: "ArgumentParser", package: "swift-argument-parser"),
+        "MMIOUtilities",
+        "SVD2LLDB",
+      ],
+      swiftSettings: [.interoperabilityMode(.Cxx)]),
+
     .executableTarget(
       name: "SVD2Swift",
       dependencies: [
@@ -50,10 +50,16 @@ struct SVD2SwiftPlugin: BuildToolPlugin {
       .map { outputDirectory.appendingPathComponent("\($0).swift") }
 
     // Produce argument list.
+    // The device cache is keyed by the SHA-256 digests of the SVD file and
+    // of svd2swift, so it never changes the generated output. It lives in the
+    // plugin work directory of the target, which only this command writes.
+    let cacheDirectory = context.pluginWorkDirectoryURL
+      .appendingPathComponent("DeviceCache")
     var arguments = [
       "--plugin",
       "--input", svdFile.path,
       "--output", outputDirectory.path,
+      "--cache-directory", cacheDirectory.path,
     ]
     if let accessLevel = pluginConfig.accessLevel {
       arguments += ["--access-level", accessLevel]
@@ -73,6 +79,9 @@ struct SVD2SwiftPlugin: BuildToolPlugin {
     if let overrideDeviceName = pluginConfig.overrideDeviceName {
       arguments += ["--device-name", "\(overrideDeviceName)"]
     }
+    if pluginConfig.relocatable == true {
+      arguments += ["--relocatable"]
+    }
     arguments += ["--peripherals"] + pluginConfig.peripherals
 
     // Create the build command.
@@ -17,6 +17,7 @@ struct SVD2SwiftPluginConfiguration {
   var namespaceUnderDevice: Bool?
   var instanceMemberPeripherals: Bool?
   var overrideDeviceName: String?
+  var relocatable: Bool?
 }
 
 extension SVD2SwiftPluginConfiguration {
@@ -28,6 +29,7 @@ extension SVD2SwiftPluginConfiguration {
     case namespaceUnderDevice = "namespace-under-device"
     case instanceMemberPeripherals = "instance-member-peripherals"
     case overrideDeviceName = "device-name"
+    case relocatable = "relocatable"
   }
 }
 
@@ -43,6 +43,7 @@ SBCommandReturnObject::~SBCommandReturnObject() ABORT
 // MARK: - SBDebugger
 SBCommandInterpreter SBDebugger::GetCommandInterpreter() ABORT
 SBTarget SBDebugger::GetSelectedTarget() ABORT
+FILE *SBDebugger::GetOutputFileHandle() ABORT
 SBDebugger::SBDebugger(SBDebugger const&) ABORT
 SBDebugger::~SBDebugger() ABORT
 
@@ -55,6 +56,10 @@ SBError::SBError() ABORT
 SBError::~SBError() ABORT
 
 // MARK: - SBProcess
+bool SBProcess::IsValid() const ABORT
+StateType SBProcess::GetState() ABORT
+uint32_t SBProcess::GetStopID(bool) ABORT
+uint32_t SBProcess::GetUniqueID() ABORT
 size_t SBProcess::ReadMemory(addr_t, void*, size_t, lldb::SBError&) ABORT
 size_t SBProcess::WriteMemory(addr_t, const void*, size_t, lldb::SBError&) ABORT
 SBProcess::~SBProcess() ABORT
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <stdio.h>
+
 #include "Vendor_SBTarget.h"
 #include "Vendor_SBCommandInterpreter.h"
 
@@ -26,6 +28,8 @@ public:
 
   ~SBDebugger();
 
+  FILE *GetOutputFileHandle();
+
   lldb::SBCommandInterpreter GetCommandInterpreter();
 
   lldb::SBTarget GetSelectedTarget();
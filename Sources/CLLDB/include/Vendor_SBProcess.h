@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "Vendor_lldb-enumerations.h"
 #include "Vendor_lldb-types.h"
 
 namespace lldb {
@@ -19,6 +20,14 @@ class SBProcess {
 public:
   ~SBProcess();
 
+  bool IsValid() const;
+
+  lldb::StateType GetState();
+
+  uint32_t GetStopID(bool include_expression_stops = false);
+
+  uint32_t GetUniqueID();
+
   size_t ReadMemory(addr_t addr, void *buf, size_t size, lldb::SBError &error);
 
   size_t WriteMemory(addr_t addr, const void *buf, size_t size,
@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A protocol representing a repeated, evenly spaced logical field within a
+/// hardware register.
+///
+/// `BitFieldArray` describes `count` identical contiguous elements, where
+/// element `index` occupies ``bitRange`` shifted left by `index * bitStride`
+/// bits. This matches hardware layouts such as a GPIO mode register with one
+/// 2-bit mode per pin, or interleaved per-channel flags in a DMA status
+/// register.
+///
+/// - Note: This protocol is primarily an internal abstraction used by code
+///   generated by Swift MMIO's bit field array macros (for example,
+///   ``MMIO/ReadWrite(bits:stride:count:as:)``). You typically do not need to
+///   conform types to `BitFieldArray` directly.
+///
+/// All element positions are computed from static properties, so accesses with
+/// a constant index fold to the same masks and shifts as an equivalent
+/// ``ContiguousBitField``.
+public protocol BitFieldArray {
+  /// The underlying integer type of the register this bit field array belongs
+  /// to.
+  associatedtype Storage: FixedWidthInteger & UnsignedInteger
+
+  /// The type each element of this bit field array projects to, if a type
+  /// projection is specified.
+  ///
+  /// If no projection is used, this defaults to `Never`.
+  associatedtype Projection: BitFieldProjectable
+
+  /// The range of bits occupied by the first element of the array.
+  static var bitRange: Range<Int> { get }
+
+  /// The number of bits from the start of one element to the start of the
+  /// next.
+  static var bitStride: Int { get }
+
+  /// The total number of elements in the array.
+  static var count: Int { get }
+}
+
+// Default implementations for BitFieldArray
+extension BitFieldArray {
+  /// The width of a single element of this bit field array, in bits.
+  @inlinable @inline(__always)
+  public static var bitWidth: Int {
+    Self.bitRange.upperBound - Self.bitRange.lowerBound
+  }
+
+  /// Returns the range of bits occupied by the element at `index`.
+  ///
+  /// - Precondition: `index` must be within the bounds `0..<Self.count`.
+  @inlinable @inline(__always)
+  public static func bitRange(at index: Int) -> Range<Int> {
+    #if hasFeature(Embedded)
+    // FIXME: Embedded doesn't have static interpolated strings yet
+    precondition(
+      0 <= index && index < Self.count,
+      "Index out of bounds")
+    #else
+    precondition(
+      0 <= index && index < Self.count,
+      "Index '\(index)' out of bounds '0..<\(Self.count)'")
+    #endif
+    let bitOffset = index * Self.bitStride
+    let lowerBound = Self.bitRange.lowerBound + bitOffset
+    let upperBound = Self.bitRange.upperBound + bitOffset
+    return lowerBound..<upperBound
+  }
+
+  /// Inserts the raw `value` of the element at `index` into the `storage` of a
+  /// register.
+  @inlinable @inline(__always)
+  public static func insertBits(
+    _ value: Storage,
+    at index: Int,
+    into storage: inout Storage
+  ) {
+    storage[bits: Self.bitRange(at: index)] = value
+  }
+
+  /// Extracts the raw value of the element at `index` from a register's
+  /// `storage`.
+  @inlinable @inline(__always)
+  public static func extractBits(
+    at index: Int,
+    from storage: Storage
+  ) -> Storage {
+    storage[bits: Self.bitRange(at: index)]
+  }
+
+  @inlinable @inline(__always)
+  static func preconditionMatchingBitWidth(
+    file: StaticString = #file,
+    line: UInt = #line
+  ) {
+    #if hasFeature(Embedded)
+    // FIXME: Embedded doesn't have static interpolated strings yet
+    precondition(
+      Self.bitWidth == Projection.bitWidth,
+      "Illegal projection of bit-field as type of differing bit-width",
+      file: file,
+      line: line)
+    #else
+    precondition(
+      Self.bitWidth == Projection.bitWidth,
+      """
+      Illegal projection of \(Self.bitWidth) bit bit-field array element \
+      '\(Self.self)' as \(Projection.bitWidth) bit type '\(Projection.self)'
+      """,
+      file: file,
+      line: line)
+    #endif
+  }
+
+  /// Inserts the projected `value` of the element at `index` into the
+  /// `storage` of a register.
+  ///
+  /// - Precondition: `Self.bitWidth` must equal `Projection.bitWidth`.
+  @inlinable @inline(__always)
+  public static func insert(
+    _ value: Projection,
+    at index: Int,
+    into storage: inout Storage
+  ) {
+    Self.preconditionMatchingBitWidth()
+    Self.insertBits(value.storage(Storage.self), at: index, into: &storage)
+  }
+
+  /// Extracts the projected value of the element at `index` from a register's
+  /// `storage`.
+  ///
+  /// - Precondition: `Self.bitWidth` must equal `Projection.bitWidth`.
+  @inlinable @inline(__always)
+  public static func extract(
+    at index: Int,
+    from storage: Storage
+  ) -> Projection {
+    Self.preconditionMatchingBitWidth()
+    return Projection(storage: Self.extractBits(at: index, from: storage))
+  }
+}
+
+/// A view of the raw integer elements of a ``BitFieldArray`` within a
+/// register value.
+///
+/// Instances are vended by the `Raw` view of registers with bit field array
+/// members; mutating an element updates the register value the view was
+/// obtained from.
+public struct BitFieldArrayRawView<Field> where Field: BitFieldArray {
+  /// The raw value of the register containing the bit field array.
+  public var storage: Field.Storage
+
+  @inlinable @inline(__always)
+  public init(_ storage: Field.Storage) {
+    self.storage = storage
+  }
+
+  /// The total number of elements in the array.
+  @inlinable @inline(__always)
+  public var count: Int { Field.count }
+
+  /// Accesses the raw value of the element at `index`.
+  ///
+  /// - Precondition: `index` must be within the bounds `0..<count`.
+  @inlinable @inline(__always)
+  public subscript<Index>(
+    _ index: Index
+  ) -> Field.Storage where Index: BinaryInteger {
+    @inlinable @inline(__always) get {
+      Field.extractBits(at: Int(index), from: self.storage)
+    }
+    @inlinable @inline(__always) set {
+      Field.insertBits(newValue, at: Int(index), into: &self.storage)
+    }
+  }
+}
+
+/// A view of the projected elements of a ``BitFieldArray`` within a register
+/// value.
+///
+/// Instances are vended by the typed `Read` and `Write` views of registers
+/// with projected bit field array members; mutating an element updates the
+/// register value the view was obtained from.
+public struct BitFieldArrayView<Field> where Field: BitFieldArray {
+  /// The raw value of the register containing the bit field array.
+  public var storage: Field.Storage
+
+  @inlinable @inline(__always)
+  public init(_ storage: Field.Storage) {
+    self.storage = storage
+  }
+
+  /// The total number of elements in the array.
+  @inlinable @inline(__always)
+  public var count: Int { Field.count }
+
+  /// Accesses the projected value of the element at `index`.
+  ///
+  /// - Precondition: `index` must be within the bounds `0..<count`.
+  @inlinable @inline(__always)
+  public subscript<Index>(
+    _ index: Index
+  ) -> Field.Projection where Index: BinaryInteger {
+    @inlinable @inline(__always) get {
+      Field.extract(at: Int(index), from: self.storage)
+    }
+    @inlinable @inline(__always) set {
+      Field.insert(newValue, at: Int(index), into: &self.storage)
+    }
+  }
+}
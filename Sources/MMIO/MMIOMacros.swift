@@ -205,3 +205,89 @@ public macro WriteOnly<Value>(
 ) =
   #externalMacro(module: "MMIOMacros", type: "WriteOnlyMacro")
 where Value: BitFieldProjectable
+
+// MARK: - Bit field array macros
+
+/// Defines an array of evenly spaced reserved bit fields within a hardware
+/// register.
+///
+/// - Parameters:
+///   - bits: A `RangeExpression` describing the bits of the first element
+///     (e.g., `0..<2` for bits 0 and 1).
+///   - stride: The number of bits from the start of one element to the start
+///     of the next.
+///   - count: The total number of elements in the array.
+///   - as: An optional type conforming to ``BitFieldProjectable`` used to
+///     represent each element.
+///
+/// For detailed usage examples and explanations, refer to <doc:Registers>.
+@attached(accessor)
+public macro Reserved<Range, Value>(
+  bits: Range, stride: Int, count: Int, as: Value.Type = Never.self
+) =
+  #externalMacro(module: "MMIOMacros", type: "ReservedArrayMacro")
+where
+  Range: RangeExpression, Range.Bound: BinaryInteger, Value: BitFieldProjectable
+
+/// Defines an array of evenly spaced read-write bit fields within a register.
+///
+/// Each element is accessed by index through the register's views, for
+/// example `value.raw.mode[3] = 0b01`.
+///
+/// - Parameters:
+///   - bits: A `RangeExpression` describing the bits of the first element
+///     (e.g., `0..<2` for bits 0 and 1).
+///   - stride: The number of bits from the start of one element to the start
+///     of the next.
+///   - count: The total number of elements in the array.
+///   - as: An optional type conforming to ``BitFieldProjectable`` used to
+///     represent each element.
+///
+/// For detailed usage examples and explanations, refer to <doc:Registers>.
+@attached(accessor)
+public macro ReadWrite<Range, Value>(
+  bits: Range, stride: Int, count: Int, as: Value.Type = Never.self
+) =
+  #externalMacro(module: "MMIOMacros", type: "ReadWriteArrayMacro")
+where
+  Range: RangeExpression, Range.Bound: BinaryInteger, Value: BitFieldProjectable
+
+/// Defines an array of evenly spaced read-only bit fields within a register.
+///
+/// - Parameters:
+///   - bits: A `RangeExpression` describing the bits of the first element
+///     (e.g., `0..<2` for bits 0 and 1).
+///   - stride: The number of bits from the start of one element to the start
+///     of the next.
+///   - count: The total number of elements in the array.
+///   - as: An optional type conforming to ``BitFieldProjectable`` used to
+///     represent each element.
+///
+/// For detailed usage examples and explanations, refer to <doc:Registers>.
+@attached(accessor)
+public macro ReadOnly<Range, Value>(
+  bits: Range, stride: Int, count: Int, as: Value.Type = Never.self
+) =
+  #externalMacro(module: "MMIOMacros", type: "ReadOnlyArrayMacro")
+where
+  Range: RangeExpression, Range.Bound: BinaryInteger, Value: BitFieldProjectable
+
+/// Defines an array of evenly spaced write-only bit fields within a register.
+///
+/// - Parameters:
+///   - bits: A `RangeExpression` describing the bits of the first element
+///     (e.g., `0..<2` for bits 0 and 1).
+///   - stride: The number of bits from the start of one element to the start
+///     of the next.
+///   - count: The total number of elements in the array.
+///   - as: An optional type conforming to ``BitFieldProjectable`` used to
+///     represent each element.
+///
+/// For detailed usage examples and explanations, refer to <doc:Registers>.
+@attached(accessor)
+public macro WriteOnly<Range, Value>(
+  bits: Range, stride: Int, count: Int, as: Value.Type = Never.self
+) =
+  #externalMacro(module: "MMIOMacros", type: "WriteOnlyArrayMacro")
+where
+  Range: RangeExpression, Range.Bound: BinaryInteger, Value: BitFieldProjectable
@@ -0,0 +1,443 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+#if canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+import MMIO
+import MMIOLinuxShims
+
+/// A region of device memory mapped into the address space of a Linux
+/// userspace process.
+///
+/// `MMIOMapping` maps the registers of a device through one of the interfaces
+/// Linux provides for userspace drivers:
+///
+/// - A memory region of a UIO device, such as `/dev/uio0`.
+/// - A BAR of a PCI device bound to the `vfio-pci` driver.
+/// - A range of physical addresses through `/dev/mem`.
+///
+/// The mapping is removed when the `MMIOMapping` is deinitialized, so
+/// register blocks are only handed out within closures which keep the
+/// mapping alive:
+///
+/// ```swift
+/// let mapping = try MMIOMapping(uioDevice: "/dev/uio0")
+/// mapping.withRegisterBlock(ExampleDevice.self) { device in
+///   device.control.modify { $0.enable = true }
+/// }
+/// ```
+///
+/// Register blocks generated by `svd2swift --relocatable` describe a device
+/// with its peripherals at offsets from a base address, and can be placed at
+/// the base of a mapping.
+///
+/// - Warning: Escaping a register block from the closure it is passed to, or
+///   storing ``unsafeBaseAddress``, leads to accesses of unmapped memory once
+///   the mapping is deinitialized.
+public final class MMIOMapping {
+  /// The address of the first byte of the mapped region.
+  public let unsafeBaseAddress: UInt
+
+  /// The number of bytes in the mapped region.
+  public let size: Int
+
+  /// The page aligned start and length of the underlying mapping.
+  let mapping: UnsafeMutableRawPointer
+  let mappingSize: Int
+
+  /// Descriptors which must stay open while the region is mapped.
+  let descriptors: [Int32]
+
+  /// Maps `size` bytes of a file, starting `offset` bytes into the file.
+  ///
+  /// The descriptor is not retained, closing it after initialization does
+  /// not affect the mapping.
+  ///
+  /// - Parameters:
+  ///   - fileDescriptor: A descriptor open for reading and writing.
+  ///   - offset: The offset of the region in the file. The offset does not
+  ///     need to be page aligned.
+  ///   - size: The number of bytes in the region.
+  public convenience init(
+    fileDescriptor: Int32,
+    offset: UInt64 = 0,
+    size: Int
+  ) throws {
+    let pageSize = UInt64(Self.pageSize)
+    let pageOffset = offset % pageSize
+    try self.init(
+      fileDescriptor: fileDescriptor,
+      fileOffset: offset - pageOffset,
+      regionOffset: Int(pageOffset),
+      size: size,
+      descriptors: [])
+  }
+
+  /// Maps a memory region of a UIO device.
+  ///
+  /// The size of the region and the offset of the device registers within
+  /// its first page are read from the device's `maps` attributes in sysfs.
+  ///
+  /// - Parameters:
+  ///   - path: The path to the device, such as `/dev/uio0`.
+  ///   - index: The index of the memory region, UIO devices may have up to
+  ///     five regions.
+  public convenience init(uioDevice path: String, map index: Int = 0) throws {
+    let name = path.split(separator: "/").last.map(String.init) ?? path
+    let attributes = "/sys/class/uio/\(name)/maps/map\(index)"
+    let size = try Self.readInteger(attribute: "\(attributes)/size")
+    let regionOffset = try Self.readInteger(attribute: "\(attributes)/offset")
+
+    let descriptor = try Self.open(path, flags: O_RDWR | O_SYNC)
+    defer { close(descriptor) }
+    // UIO selects memory region N with an mmap offset of N pages.
+    try self.init(
+      fileDescriptor: descriptor,
+      fileOffset: UInt64(index) * UInt64(Self.pageSize),
+      regionOffset: regionOffset,
+      size: size,
+      descriptors: [])
+  }
+
+  /// Maps a BAR of a PCI device bound to the `vfio-pci` driver.
+  ///
+  /// The device's IOMMU group is attached to a new VFIO container, which is
+  /// kept open as long as the mapping. Groups without an IOMMU are supported
+  /// if the `vfio` module was loaded with `enable_unsafe_noiommu_mode`.
+  ///
+  /// - Parameters:
+  ///   - address: The PCI address of the device, such as `0000:01:00.0`.
+  ///   - bar: The index of the BAR, from 0 through 5.
+  public convenience init(vfioDevice address: String, bar: Int) throws {
+    let region = try Self.openVFIORegion(address: address, bar: bar)
+    try self.init(
+      fileDescriptor: region.device,
+      fileOffset: region.offset,
+      regionOffset: 0,
+      size: region.size,
+      descriptors: region.descriptors)
+  }
+
+  /// Maps a range of physical addresses through `/dev/mem`.
+  ///
+  /// Mapping physical memory requires `CAP_SYS_RAWIO`, and kernels built with
+  /// `CONFIG_STRICT_DEVMEM` only allow mapping addresses which are not
+  /// claimed by a driver.
+  ///
+  /// - Parameters:
+  ///   - physicalAddress: The physical address of the first byte of the
+  ///     region. The address does not need to be page aligned.
+  ///   - size: The number of bytes in the region.
+  public convenience init(physicalAddress: UInt64, size: Int) throws {
+    let descriptor = try Self.open("/dev/mem", flags: O_RDWR | O_SYNC)
+    defer { close(descriptor) }
+    try self.init(
+      fileDescriptor: descriptor,
+      offset: physicalAddress,
+      size: size)
+  }
+
+  /// Maps a new zero-filled region of anonymous shared memory, backed by a
+  /// memfd, in place of device memory.
+  ///
+  /// Anonymous mappings allow drivers to be tested against a fake device
+  /// region without hardware or privileges.
+  ///
+  /// - Parameters:
+  ///   - name: The name of the memfd, shown in `/proc/<pid>/maps`.
+  ///   - size: The number of bytes in the region.
+  public convenience init(anonymousNamed name: String, size: Int) throws {
+    let descriptor = mmio_memfd_create(name, 0)
+    guard descriptor >= 0 else {
+      throw MMIOMappingError.systemCall("memfd_create", errno: errno)
+    }
+    defer { close(descriptor) }
+    guard ftruncate(descriptor, off_t(size)) == 0 else {
+      throw MMIOMappingError.systemCall("ftruncate", errno: errno)
+    }
+    try self.init(fileDescriptor: descriptor, size: size)
+  }
+
+  init(
+    fileDescriptor: Int32,
+    fileOffset: UInt64,
+    regionOffset: Int,
+    size: Int,
+    descriptors: [Int32]
+  ) throws {
+    let (mappingSize, overflow) = regionOffset.addingReportingOverflow(size)
+    guard size > 0, !overflow else {
+      for descriptor in descriptors.reversed() {
+        close(descriptor)
+      }
+      throw MMIOMappingError.invalidSize(size)
+    }
+    let mapping = mmap(
+      nil, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor,
+      off_t(fileOffset))
+    guard let mapping, mapping != UnsafeMutableRawPointer(bitPattern: -1) else {
+      let error = errno
+      for descriptor in descriptors.reversed() {
+        close(descriptor)
+      }
+      throw MMIOMappingError.systemCall("mmap", errno: error)
+    }
+    self.mapping = mapping
+    self.mappingSize = mappingSize
+    self.unsafeBaseAddress = UInt(bitPattern: mapping + regionOffset)
+    self.size = size
+    self.descriptors = descriptors
+  }
+
+  deinit {
+    munmap(self.mapping, self.mappingSize)
+    for descriptor in self.descriptors.reversed() {
+      close(descriptor)
+    }
+  }
+}
+
+extension MMIOMapping {
+  /// Calls `body` with the address of the byte at `offset` in the mapped
+  /// region, keeping the mapping alive until `body` returns.
+  ///
+  /// - Precondition: The `count` bytes starting at `offset` must be within
+  ///   the mapped region.
+  ///
+  /// - Parameters:
+  ///   - offset: The offset of the first byte in the mapped region.
+  ///   - count: The number of bytes `body` accesses.
+  ///   - body: A closure which accesses the memory at the address.
+  @inlinable @inline(__always)
+  public func withUnsafeAddress<Result>(
+    at offset: UInt = 0,
+    count: UInt = 1,
+    _ body: (UInt) throws -> Result
+  ) rethrows -> Result {
+    let size = UInt(self.size)
+    precondition(
+      offset < size && count <= size - offset,
+      "Range '\(offset)..<\(offset &+ count)' out of bounds '0..<\(size)'")
+    return try withExtendedLifetime(self) {
+      try body(self.unsafeBaseAddress + offset)
+    }
+  }
+
+  /// Calls `body` with a register block placed at `offset` in the mapped
+  /// region, keeping the mapping alive until `body` returns.
+  ///
+  /// Register blocks do not describe their extent, so only `offset` is
+  /// checked against the mapped region. Callers must ensure every register
+  /// in the block is within the region, for example by mapping the full size
+  /// of the device. Single `Register` types are checked in full.
+  ///
+  /// - Precondition: `offset` must be within the mapped region.
+  ///
+  /// - Parameters:
+  ///   - type: The type of the register block, such as a device generated by
+  ///     `svd2swift --relocatable` or a single `Register`.
+  ///   - offset: The offset of the register block in the mapped region.
+  ///   - body: A closure which accesses the register block. The register
+  ///     block must not escape the closure.
+  @inlinable @inline(__always)
+  public func withRegisterBlock<Block, Result>(
+    _ type: Block.Type = Block.self,
+    at offset: UInt = 0,
+    _ body: (Block) throws -> Result
+  ) rethrows -> Result where Block: RegisterProtocol {
+    try self.withUnsafeAddress(at: offset) { address in
+      try body(Block(unsafeAddress: address))
+    }
+  }
+
+  /// Calls `body` with a register placed at `offset` in the mapped region,
+  /// keeping the mapping alive until `body` returns.
+  ///
+  /// - Precondition: Every byte of the register must be within the mapped
+  ///   region.
+  ///
+  /// - Parameters:
+  ///   - type: The type of the register.
+  ///   - offset: The offset of the register in the mapped region.
+  ///   - body: A closure which accesses the register. The register must not
+  ///     escape the closure.
+  @inlinable @inline(__always)
+  public func withRegisterBlock<Value, Result>(
+    _ type: Register<Value>.Type = Register<Value>.self,
+    at offset: UInt = 0,
+    _ body: (Register<Value>) throws -> Result
+  ) rethrows -> Result {
+    let count = UInt(MemoryLayout<Value.Raw.Storage>.size)
+    return try self.withUnsafeAddress(at: offset, count: count) { address in
+      try body(Register(unsafeAddress: address))
+    }
+  }
+}
+
+extension MMIOMapping {
+  /// The size of a page of memory, which mappings are aligned to.
+  static var pageSize: Int { Int(sysconf(Int32(_SC_PAGESIZE))) }
+
+  static func open(_ path: String, flags: Int32) throws -> Int32 {
+    let descriptor = openFile(path, flags)
+    guard descriptor >= 0 else {
+      throw MMIOMappingError.systemCall("open '\(path)'", errno: errno)
+    }
+    return descriptor
+  }
+
+  static func ioctl<Argument>(
+    _ name: String,
+    _ descriptor: Int32,
+    _ request: UInt,
+    _ argument: inout Argument
+  ) throws {
+    guard mmio_ioctl_pointer(descriptor, request, &argument) == 0 else {
+      throw MMIOMappingError.systemCall(name, errno: errno)
+    }
+  }
+
+  /// Reads a sysfs attribute containing a decimal or `0x` prefixed
+  /// hexadecimal integer.
+  static func readInteger(attribute path: String) throws -> Int {
+    let descriptor = try Self.open(path, flags: O_RDONLY)
+    defer { close(descriptor) }
+    var buffer = [UInt8](repeating: 0, count: 64)
+    let count = read(descriptor, &buffer, buffer.count)
+    guard count >= 0 else {
+      throw MMIOMappingError.systemCall("read '\(path)'", errno: errno)
+    }
+    let text = String(decoding: buffer[..<count], as: UTF8.self)
+      .filter { !$0.isWhitespace }
+    let value =
+      if text.hasPrefix("0x") {
+        Int(text.dropFirst(2), radix: 16)
+      } else {
+        Int(text)
+      }
+    guard let value else {
+      throw MMIOMappingError.invalidAttribute(path, text)
+    }
+    return value
+  }
+
+  /// Returns the IOMMU group of a PCI device, the last path component of its
+  /// `iommu_group` link in sysfs.
+  static func iommuGroup(of address: String) throws -> String {
+    let path = "/sys/bus/pci/devices/\(address)/iommu_group"
+    var buffer = [CChar](repeating: 0, count: Int(PATH_MAX))
+    let count = readlink(path, &buffer, buffer.count - 1)
+    guard count > 0 else {
+      throw MMIOMappingError.systemCall("readlink '\(path)'", errno: errno)
+    }
+    let target = String(
+      decoding: buffer[..<count].map { UInt8(bitPattern: $0) },
+      as: UTF8.self)
+    guard let group = target.split(separator: "/").last else {
+      throw MMIOMappingError.invalidAttribute(path, target)
+    }
+    return String(group)
+  }
+
+  /// Attaches the IOMMU group of a PCI device to a new VFIO container and
+  /// returns the location of a BAR in the device's descriptor.
+  ///
+  /// The returned descriptors include the container, group, and device, and
+  /// must stay open while the BAR is mapped.
+  static func openVFIORegion(
+    address: String,
+    bar: Int
+  ) throws -> (device: Int32, offset: UInt64, size: Int, descriptors: [Int32]) {
+    let group = try Self.iommuGroup(of: address)
+    var descriptors: [Int32] = []
+    do {
+      let container = try Self.open("/dev/vfio/vfio", flags: O_RDWR)
+      descriptors.append(container)
+      guard
+        mmio_ioctl(container, MMIO_VFIO_GET_API_VERSION, 0) == VFIO_API_VERSION
+      else {
+        throw MMIOMappingError.unsupported("VFIO API version")
+      }
+
+      let groupDescriptor: Int32
+      do {
+        groupDescriptor = try Self.open("/dev/vfio/\(group)", flags: O_RDWR)
+      } catch {
+        groupDescriptor = try Self.open(
+          "/dev/vfio/noiommu-\(group)", flags: O_RDWR)
+      }
+      descriptors.append(groupDescriptor)
+
+      var status = vfio_group_status()
+      status.argsz = UInt32(MemoryLayout<vfio_group_status>.size)
+      try Self.ioctl(
+        "VFIO_GROUP_GET_STATUS", groupDescriptor, MMIO_VFIO_GROUP_GET_STATUS,
+        &status)
+      guard status.flags & UInt32(VFIO_GROUP_FLAGS_VIABLE) != 0 else {
+        throw MMIOMappingError.unsupported(
+          "IOMMU group \(group) with devices not bound to vfio-pci")
+      }
+
+      var containerDescriptor = container
+      try Self.ioctl(
+        "VFIO_GROUP_SET_CONTAINER", groupDescriptor,
+        MMIO_VFIO_GROUP_SET_CONTAINER, &containerDescriptor)
+      let iommuTypes = [
+        VFIO_TYPE1v2_IOMMU, VFIO_TYPE1_IOMMU, VFIO_NOIOMMU_IOMMU,
+      ]
+      guard
+        let iommuType = iommuTypes.first(where: {
+          mmio_ioctl(container, MMIO_VFIO_CHECK_EXTENSION, UInt($0)) > 0
+        }),
+        mmio_ioctl(container, MMIO_VFIO_SET_IOMMU, UInt(iommuType)) == 0
+      else {
+        throw MMIOMappingError.systemCall("VFIO_SET_IOMMU", errno: errno)
+      }
+
+      let device = address.withCString { address in
+        mmio_ioctl_pointer(
+          groupDescriptor, MMIO_VFIO_GROUP_GET_DEVICE_FD,
+          UnsafeMutableRawPointer(mutating: address))
+      }
+      guard device >= 0 else {
+        throw MMIOMappingError.systemCall(
+          "VFIO_GROUP_GET_DEVICE_FD", errno: errno)
+      }
+      descriptors.append(device)
+
+      var region = vfio_region_info()
+      region.argsz = UInt32(MemoryLayout<vfio_region_info>.size)
+      region.index = UInt32(bar)
+      try Self.ioctl(
+        "VFIO_DEVICE_GET_REGION_INFO", device,
+        MMIO_VFIO_DEVICE_GET_REGION_INFO, &region)
+      guard region.flags & UInt32(VFIO_REGION_INFO_FLAG_MMAP) != 0 else {
+        throw MMIOMappingError.unsupported("mapping BAR \(bar) of \(address)")
+      }
+      return (device, region.offset, Int(region.size), descriptors)
+    } catch {
+      for descriptor in descriptors.reversed() {
+        close(descriptor)
+      }
+      throw error
+    }
+  }
+}
+
+// Wrapper for the system call shadowed by `MMIOMapping.open(_:flags:)`.
+private func openFile(_ path: String, _ flags: Int32) -> Int32 {
+  open(path, flags)
+}
+#endif
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+#if canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+
+/// An error encountered while creating an ``MMIOMapping``.
+public enum MMIOMappingError: Error {
+  /// A system call failed with an `errno` value.
+  case systemCall(String, errno: Int32)
+  /// A sysfs attribute did not contain the expected value.
+  case invalidAttribute(String, String)
+  /// The device or kernel does not support the requested mapping.
+  case unsupported(String)
+  /// The requested region is empty or does not fit in the address space.
+  case invalidSize(Int)
+}
+
+extension MMIOMappingError: CustomStringConvertible {
+  public var description: String {
+    switch self {
+    case .systemCall(let operation, let errno):
+      "\(operation) failed: \(String(cString: strerror(errno)))."
+    case .invalidAttribute(let path, let value):
+      "Invalid value '\(value)' for attribute '\(path)'."
+    case .unsupported(let feature):
+      "Unsupported \(feature)."
+    case .invalidSize(let size):
+      "Invalid mapping size '\(size)'."
+    }
+  }
+}
+#endif
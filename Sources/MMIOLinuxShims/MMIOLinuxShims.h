@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Linux interfaces used by MMIOLinux which Swift cannot import directly:
+// variadic system calls and ioctl request numbers defined by function-like
+// macros.
+#if defined(__linux__)
+
+#include <linux/vfio.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static inline int mmio_memfd_create(const char * _Nonnull name,
+                                    unsigned int flags) {
+  return (int)syscall(SYS_memfd_create, name, flags);
+}
+
+static inline int mmio_ioctl(int descriptor, unsigned long request,
+                             unsigned long argument) {
+  return ioctl(descriptor, request, argument);
+}
+
+static inline int mmio_ioctl_pointer(int descriptor, unsigned long request,
+                                     void * _Nonnull argument) {
+  return ioctl(descriptor, request, argument);
+}
+
+static const unsigned long MMIO_VFIO_GET_API_VERSION = VFIO_GET_API_VERSION;
+static const unsigned long MMIO_VFIO_CHECK_EXTENSION = VFIO_CHECK_EXTENSION;
+static const unsigned long MMIO_VFIO_SET_IOMMU = VFIO_SET_IOMMU;
+static const unsigned long MMIO_VFIO_GROUP_GET_STATUS = VFIO_GROUP_GET_STATUS;
+static const unsigned long MMIO_VFIO_GROUP_SET_CONTAINER =
+    VFIO_GROUP_SET_CONTAINER;
+static const unsigned long MMIO_VFIO_GROUP_GET_DEVICE_FD =
+    VFIO_GROUP_GET_DEVICE_FD;
+static const unsigned long MMIO_VFIO_DEVICE_GET_REGION_INFO =
+    VFIO_DEVICE_GET_REGION_INFO;
+
+#endif
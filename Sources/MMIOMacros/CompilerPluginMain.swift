@@ -25,5 +25,9 @@ struct CompilerPluginMain: CompilerPlugin {
     ReadWriteMacro.self,
     ReadOnlyMacro.self,
     WriteOnlyMacro.self,
+    ReservedArrayMacro.self,
+    ReadWriteArrayMacro.self,
+    ReadOnlyArrayMacro.self,
+    WriteOnlyArrayMacro.self,
   ]
 }
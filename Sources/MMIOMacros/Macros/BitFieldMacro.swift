@@ -15,14 +15,22 @@ import SwiftSyntaxBuilder
 import SwiftSyntaxMacros
 
 // @BaseName(bits: 3..<4, 0..<1, as: Swift.Bool.self)
+// @BaseName(bits: 0..<2, stride: 2, count: 16, as: Swift.Bool.self)
 protocol BitFieldMacro: MMIOAccessorMacro, ParsableMacro {
   static var isReadable: Bool { get }
   static var isWriteable: Bool { get }
   static var isSymmetric: Bool { get }
 
+  /// The bit ranges occupied by the field. For bit field arrays this contains
+  /// the range of every element, starting with the first.
   var bitRanges: [BitRange] { get }
   var bitRangeExpressions: [ExprSyntax] { get }
   var projectedType: BitFieldTypeProjection? { get }
+  var array: (stride: Int, count: Int)? { get }
+}
+
+extension BitFieldMacro {
+  var array: (stride: Int, count: Int)? { nil }
 }
 
 extension BitFieldMacro {
@@ -61,6 +69,51 @@ let bitFieldMacros: [any BitFieldMacro.Type] = [
   WriteOnlyMacro.self,
 ]
 
+// Bit field array macros share base names with the scalar bit field macros
+// and are distinguished by their `stride` argument.
+let bitFieldArrayMacros: [any BitFieldMacro.Type] = [
+  ReservedArrayMacro.self,
+  ReadWriteArrayMacro.self,
+  ReadOnlyArrayMacro.self,
+  WriteOnlyArrayMacro.self,
+]
+
+extension MatchingAttributeAndMacro {
+  /// The bit field macro type matching both the attribute's name and its
+  /// argument labels.
+  var bitFieldMacroType: (any BitFieldMacro.Type)? {
+    let arguments =
+      self.attribute.arguments?.as(LabeledExprListSyntax.self)
+      ?? LabeledExprListSyntax()
+    let isArray = arguments.contains { $0.label?.text == "stride" }
+    guard isArray else { return self.macroType as? any BitFieldMacro.Type }
+    return bitFieldArrayMacros.first { $0.baseName == self.macroType.baseName }
+  }
+}
+
+extension BitRange {
+  /// Returns this bit range moved up by `offset` bits.
+  func shifted(by offset: Int) -> Self {
+    var copy = self
+    copy.lowerBound?.value += offset
+    copy.upperBound?.value += offset
+    return copy
+  }
+}
+
+/// Expands the bit range of the first element of a bit field array into the
+/// bit ranges of every element.
+///
+/// The first element is always included so invalid counts are diagnosed
+/// during validation instead of producing an empty field.
+func bitFieldArrayElementRanges(
+  _ bitRange: BitRange,
+  stride: Int,
+  count: Int
+) -> [BitRange] {
+  (0..<max(count, 1)).map { bitRange.shifted(by: $0 * stride) }
+}
+
 public struct ReservedMacro: BitFieldMacro {
   static let accessorMacroSuppressParsingDiagnostics = false
   static let baseName = "Reserved"
@@ -180,3 +233,187 @@ public struct WriteOnlyMacro: BitFieldMacro {
     }
   }
 }
+
+public struct ReservedArrayMacro: BitFieldMacro {
+  static let accessorMacroSuppressParsingDiagnostics = false
+  static let baseName = "Reserved"
+  static let isReadable = false
+  static let isWriteable = false
+  static let isSymmetric = true
+
+  @Argument(label: "bits")
+  var bitRange: BitRange
+  @Argument(label: "stride")
+  var stride: Int
+  @Argument(label: "count")
+  var count: Int
+
+  var bitRanges: [BitRange] {
+    bitFieldArrayElementRanges(
+      self.bitRange, stride: self.stride, count: self.count)
+  }
+  var bitRangeExpressions: [ExprSyntax] {
+    Array(repeating: self.$bitRange, count: max(self.count, 1))
+  }
+  var array: (stride: Int, count: Int)? { (self.stride, self.count) }
+
+  @Argument(label: "as")
+  var projectedType: BitFieldTypeProjection?
+
+  mutating func update(
+    label: String,
+    from expression: ExprSyntax,
+    in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
+  ) throws {
+    switch label {
+    case "bits":
+      try self._bitRange.update(from: expression, in: context)
+    case "stride":
+      try self._stride.update(from: expression, in: context)
+    case "count":
+      try self._count.update(from: expression, in: context)
+    case "as":
+      try self._projectedType.update(from: expression, in: context)
+    default:
+      fatalError()
+    }
+  }
+}
+
+public struct ReadWriteArrayMacro: BitFieldMacro {
+  static let accessorMacroSuppressParsingDiagnostics = false
+  static let baseName = "ReadWrite"
+  static let isReadable = true
+  static let isWriteable = true
+  static let isSymmetric = true
+
+  @Argument(label: "bits")
+  var bitRange: BitRange
+  @Argument(label: "stride")
+  var stride: Int
+  @Argument(label: "count")
+  var count: Int
+
+  var bitRanges: [BitRange] {
+    bitFieldArrayElementRanges(
+      self.bitRange, stride: self.stride, count: self.count)
+  }
+  var bitRangeExpressions: [ExprSyntax] {
+    Array(repeating: self.$bitRange, count: max(self.count, 1))
+  }
+  var array: (stride: Int, count: Int)? { (self.stride, self.count) }
+
+  @Argument(label: "as")
+  var projectedType: BitFieldTypeProjection?
+
+  mutating func update(
+    label: String,
+    from expression: ExprSyntax,
+    in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
+  ) throws {
+    switch label {
+    case "bits":
+      try self._bitRange.update(from: expression, in: context)
+    case "stride":
+      try self._stride.update(from: expression, in: context)
+    case "count":
+      try self._count.update(from: expression, in: context)
+    case "as":
+      try self._projectedType.update(from: expression, in: context)
+    default:
+      fatalError()
+    }
+  }
+}
+
+public struct ReadOnlyArrayMacro: BitFieldMacro {
+  static let accessorMacroSuppressParsingDiagnostics = false
+  static let baseName = "ReadOnly"
+  static let isReadable = true
+  static let isWriteable = false
+  static let isSymmetric = false
+
+  @Argument(label: "bits")
+  var bitRange: BitRange
+  @Argument(label: "stride")
+  var stride: Int
+  @Argument(label: "count")
+  var count: Int
+
+  var bitRanges: [BitRange] {
+    bitFieldArrayElementRanges(
+      self.bitRange, stride: self.stride, count: self.count)
+  }
+  var bitRangeExpressions: [ExprSyntax] {
+    Array(repeating: self.$bitRange, count: max(self.count, 1))
+  }
+  var array: (stride: Int, count: Int)? { (self.stride, self.count) }
+
+  @Argument(label: "as")
+  var projectedType: BitFieldTypeProjection?
+
+  mutating func update(
+    label: String,
+    from expression: ExprSyntax,
+    in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
+  ) throws {
+    switch label {
+    case "bits":
+      try self._bitRange.update(from: expression, in: context)
+    case "stride":
+      try self._stride.update(from: expression, in: context)
+    case "count":
+      try self._count.update(from: expression, in: context)
+    case "as":
+      try self._projectedType.update(from: expression, in: context)
+    default:
+      fatalError()
+    }
+  }
+}
+
+public struct WriteOnlyArrayMacro: BitFieldMacro {
+  static let accessorMacroSuppressParsingDiagnostics = false
+  static let baseName = "WriteOnly"
+  static let isReadable = false
+  static let isWriteable = true
+  static let isSymmetric = false
+
+  @Argument(label: "bits")
+  var bitRange: BitRange
+  @Argument(label: "stride")
+  var stride: Int
+  @Argument(label: "count")
+  var count: Int
+
+  var bitRanges: [BitRange] {
+    bitFieldArrayElementRanges(
+      self.bitRange, stride: self.stride, count: self.count)
+  }
+  var bitRangeExpressions: [ExprSyntax] {
+    Array(repeating: self.$bitRange, count: max(self.count, 1))
+  }
+  var array: (stride: Int, count: Int)? { (self.stride, self.count) }
+
+  @Argument(label: "as")
+  var projectedType: BitFieldTypeProjection?
+
+  mutating func update(
+    label: String,
+    from expression: ExprSyntax,
+    in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
+  ) throws {
+    switch label {
+    case "bits":
+      try self._bitRange.update(from: expression, in: context)
+    case "stride":
+      try self._stride.update(from: expression, in: context)
+    case "count":
+      try self._count.update(from: expression, in: context)
+    case "as":
+      try self._projectedType.update(from: expression, in: context)
+    default:
+      fatalError()
+    }
+  }
+}
@@ -22,6 +22,7 @@ struct BitFieldDescription {
   var bitRanges: [BitRange]
   var bitRangeExpressions: [ExprSyntax]
   var projectedType: ExprSyntax?
+  var array: (stride: Int, count: Int)?
 }
 
 extension BitFieldDescription {
@@ -47,6 +48,23 @@ extension BitFieldDescription {
   }
 
   func declarations() -> [DeclSyntax] {
+    if let array = self.array {
+      // Bit field arrays store the range of the first element; `bitRanges`
+      // holds every element for validation.
+      let bitRangeExpression = self.bitRangeExpression(self.bitRanges[0])
+      return [
+        """
+        \(self.accessLevel)enum \(self.fieldType): BitFieldArray {
+          \(self.accessLevel)typealias Storage = \(self.storageType())
+          \(self.accessLevel)typealias Projection = \(self.projectedType ?? "Never")
+          \(self.accessLevel)static let bitRange = \(bitRangeExpression)
+          \(self.accessLevel)static let bitStride = \(IntegerLiteralExprSyntax(array.stride))
+          \(self.accessLevel)static let count = \(IntegerLiteralExprSyntax(array.count))
+        }
+        """
+      ]
+    }
+
     switch bitRanges.count {
     case 0:
       preconditionFailure()
@@ -80,16 +98,29 @@ extension BitFieldDescription {
 
 extension BitFieldDescription {
   func rawVariableDeclaration() -> DeclSyntax {
-    """
-    \(self.accessLevel)var \(self.fieldName): \(self.storageType()) {
-      @inlinable @inline(__always) get {
-        \(self.fieldType).extractBits(from: self.storage)
-      }
-      @inlinable @inline(__always) set {
-        \(self.fieldType).insertBits(newValue, into: &self.storage)
-      }
+    if self.array != nil {
+      return """
+        \(self.accessLevel)var \(self.fieldName): BitFieldArrayRawView<\(self.fieldType)> {
+          @inlinable @inline(__always) get {
+            .init(self.storage)
+          }
+          @inlinable @inline(__always) set {
+            self.storage = newValue.storage
+          }
+        }
+        """
     }
-    """
+
+    return """
+      \(self.accessLevel)var \(self.fieldName): \(self.storageType()) {
+        @inlinable @inline(__always) get {
+          \(self.fieldType).extractBits(from: self.storage)
+        }
+        @inlinable @inline(__always) set {
+          \(self.fieldType).insertBits(newValue, into: &self.storage)
+        }
+      }
+      """
   }
 
   func readWriteVariableDeclaration() -> DeclSyntax? {
@@ -101,6 +132,10 @@ extension BitFieldDescription {
       return nil
     }
 
+    if self.array != nil {
+      return self.arrayVariableDeclaration(isWriteable: true)
+    }
+
     return """
       \(self.accessLevel)var \(self.fieldName): \(projectedType) {
         @inlinable @inline(__always) get {
@@ -121,6 +156,10 @@ extension BitFieldDescription {
       return nil
     }
 
+    if self.array != nil {
+      return self.arrayVariableDeclaration(isWriteable: false)
+    }
+
     return """
       \(self.accessLevel)var \(self.fieldName): \(projectedType) {
         @inlinable @inline(__always) get {
@@ -138,6 +177,12 @@ extension BitFieldDescription {
       return nil
     }
 
+    // Element writes go through the getter of the array view, so the getter
+    // cannot be deprecated like the scalar case below.
+    if self.array != nil {
+      return self.arrayVariableDeclaration(isWriteable: true)
+    }
+
     // FIXME: improve warning message
     // blocked-by: rdar://116130327 (Customizable deprecation messages)
 
@@ -153,4 +198,27 @@ extension BitFieldDescription {
       }
       """
   }
+
+  func arrayVariableDeclaration(isWriteable: Bool) -> DeclSyntax {
+    guard isWriteable else {
+      return """
+        \(self.accessLevel)var \(self.fieldName): BitFieldArrayView<\(self.fieldType)> {
+          @inlinable @inline(__always) get {
+            .init(self.storage)
+          }
+        }
+        """
+    }
+
+    return """
+      \(self.accessLevel)var \(self.fieldName): BitFieldArrayView<\(self.fieldType)> {
+        @inlinable @inline(__always) get {
+          .init(self.storage)
+        }
+        @inlinable @inline(__always) set {
+          self.storage = newValue.storage
+        }
+      }
+      """
+  }
 }
@@ -19,10 +19,29 @@ extension BitFieldDescription {
   func validate(
     in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
   ) {
+    self.validateArray(in: context)
     self.validateBounds(in: context)
     self.validateOverlappingRanges(in: context)
   }
 
+  func validateArray(
+    in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
+  ) {
+    guard let array = self.array else { return }
+    if array.count < 1 {
+      _ = context.error(
+        at: self.attribute.attributeName,
+        message: .bitFieldArrayInvalidCount(
+          attribute: "\(self.attribute.trimmed)"))
+    }
+    if array.stride < 1 {
+      _ = context.error(
+        at: self.attribute.attributeName,
+        message: .bitFieldArrayInvalidStride(
+          attribute: "\(self.attribute.trimmed)"))
+    }
+  }
+
   func validateBounds(
     in context: MacroContext<some ParsableMacro, some MacroExpansionContext>
   ) {
@@ -374,6 +393,18 @@ extension ErrorDiagnostic {
     .init("overlapping bit ranges in '\(attribute)'")
   }
 
+  static func bitFieldArrayInvalidCount(
+    attribute: String
+  ) -> Self {
+    .init("bit field array count in '\(attribute)' must be greater than zero")
+  }
+
+  static func bitFieldArrayInvalidStride(
+    attribute: String
+  ) -> Self {
+    .init("bit field array stride in '\(attribute)' must be greater than zero")
+  }
+
   static func registerOverlappingBitRanges(
     name: String
   ) -> Self {
@@ -67,8 +67,8 @@ extension RegisterMacro: MMIOMemberMacro {
         // Each declaration must be annotated with exactly one bitField macro.
         // Further syntactic checking will be performed by that macro.
         let value = try? variableDecl.requireMacro(bitFieldMacros, context),
-        // This will always succeed.
-        let macroType = value.macroType as? any (BitFieldMacro.Type),
+        // Select the scalar or array variant of the bitField macro.
+        let macroType = value.bitFieldMacroType,
 
         // Parse the arguments from the bitField macro.
         let macro = try? macroType.init(
@@ -98,7 +98,8 @@ extension RegisterMacro: MMIOMemberMacro {
           fieldType: fieldType,
           bitRanges: macro.bitRanges,
           bitRangeExpressions: macro.bitRangeExpressions,
-          projectedType: macro.projectedType?.expression))
+          projectedType: macro.projectedType?.expression,
+          array: macro.array))
     }
     guard !error else { return [] }
 
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Dispatch
+
+/// Calls `body` once for each element of `elements` using at most
+/// `maximumConcurrency` threads, returning after every call has completed.
+public func concurrentForEach<Element>(
+  _ elements: [Element],
+  maximumConcurrency: Int,
+  body: @escaping @Sendable (Element) -> Void
+) where Element: Sendable {
+  let nextIndex = Mutex(elements.startIndex)
+  let group = DispatchGroup()
+  let workerCount = min(max(maximumConcurrency, 1), elements.count)
+  for _ in 0..<workerCount {
+    DispatchQueue.global().async(group: group) {
+      while true {
+        let index = nextIndex.withLock { nextIndex in
+          defer { nextIndex += 1 }
+          return nextIndex
+        }
+        guard index < elements.endIndex else { return }
+        body(elements[index])
+      }
+    }
+  }
+  group.wait()
+}
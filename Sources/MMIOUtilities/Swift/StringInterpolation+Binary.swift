@@ -39,4 +39,31 @@ extension String.StringInterpolation {
       value <<= 1
     }
   }
+
+  /// Appends a value wider than any integer type, stored as little-endian
+  /// 64-bit words, in the same format as
+  /// ``appendInterpolation(binary:bits:segmented:)``.
+  public mutating func appendInterpolation(
+    binary words: [UInt64],
+    bits size: Int,
+    segmented: Bool = true
+  ) {
+    precondition(size <= words.count * UInt64.bitWidth)
+    let digitsBeforeUnderscore = size % 4
+
+    self.appendLiteral("0b")
+    for offset in 0..<size {
+      if segmented, offset != 0, (offset - digitsBeforeUnderscore) % 4 == 0 {
+        self.appendLiteral("_")
+      }
+      // Bits are printed from the most significant bit down.
+      let bit = size - 1 - offset
+      let word = words[bit / UInt64.bitWidth]
+      if (word >> (bit % UInt64.bitWidth)) & 1 == 0 {
+        self.appendInterpolation("0")
+      } else {
+        self.appendInterpolation("1")
+      }
+    }
+  }
 }
@@ -78,4 +78,38 @@ extension String.StringInterpolation {
       value <<= nibbleBitWidth
     }
   }
+
+  /// Appends a value wider than any integer type, stored as little-endian
+  /// 64-bit words, in the same format as ``appendInterpolation(hex:bits:)``.
+  public mutating func appendInterpolation(
+    hex words: [UInt64],
+    bits bitWidth: some FixedWidthInteger
+  ) {
+    let bitWidth = Int(bitWidth)
+    precondition(bitWidth > 0)
+    precondition(bitWidth <= words.count * UInt64.bitWidth)
+    let nibbleBitWidth = 4
+    let segmentWidth = 4
+    let nibblesPerWord = UInt64.bitWidth / nibbleBitWidth
+    let digits = bitWidth.roundUp(toMultipleOf: nibbleBitWidth) / nibbleBitWidth
+    let digitsBeforeSeparator = digits % segmentWidth
+
+    self.appendLiteral("0x")
+    for digit in 0..<digits {
+      if digit != 0, (digit - digitsBeforeSeparator) % segmentWidth == 0 {
+        self.appendLiteral("_")
+      }
+      // Digits are printed from the most significant nibble down.
+      let nibbleIndex = digits - 1 - digit
+      let word = words[nibbleIndex / nibblesPerWord]
+      let shift = (nibbleIndex % nibblesPerWord) * nibbleBitWidth
+      var nibble = (word >> shift) & 0b1111
+      // Mask the bits of the top nibble beyond the requested bit width.
+      let nibbleBits = bitWidth - nibbleIndex * nibbleBitWidth
+      if nibbleBits < nibbleBitWidth {
+        nibble &= (1 << nibbleBits) - 1
+      }
+      self.appendInterpolation(hexNibble: nibble)
+    }
+  }
 }
@@ -19,8 +19,20 @@ struct SVDDecodingError: Error, CustomStringConvertible {
 
 extension SVDDevice {
   public init(data: Data) throws {
+    try self.init(data: data, didBuildXML: {})
+  }
+
+  /// Decodes a device from raw SVD data.
+  ///
+  /// - Parameters:
+  ///   - data: The contents of an SVD file.
+  ///   - didBuildXML: A closure invoked after the XML document has been parsed
+  ///     and before it is decoded into SVD types. Callers can use this to
+  ///     measure the two phases independently.
+  public init(data: Data, didBuildXML: () -> Void) throws {
     let root = try XMLElementBuilder.build(data: data)
       .unwrap(or: SVDDecodingError(description: "Missing root XML element"))
+    didBuildXML()
     try self.init(root)
   }
 }
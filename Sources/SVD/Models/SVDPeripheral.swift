@@ -94,12 +94,12 @@ public struct SVDPeripheral {
   /// peripheral.
   @XMLInlineElement
   public var registerProperties: SVDRegisterProperties = .init()
-  /// Specify an address range uniquely mapped to this peripheral.
+  /// Specify the address ranges uniquely mapped to this peripheral.
   ///
   /// A peripheral must have at least one address block, but can allocate
   /// multiple distinct address ranges. If a peripheral is derived from
   /// another peripheral, the addressBlock is not mandatory.
-  public var addressBlock: SVDAddressBlock?  // FIXME: Array<SVDAddressBlock>
+  public var addressBlock: [SVDAddressBlock]?
   /// A peripheral can have multiple associated interrupts.
   ///
   /// This entry allows the debugger to show interrupt names instead of
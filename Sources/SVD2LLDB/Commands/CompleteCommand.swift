@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+
+struct CompleteCommand: SVD2LLDBCommand {
+  static let autoRepeat = ""
+  static let configuration = CommandConfiguration(
+    commandName: "complete",
+    _superCommandName: "svd",
+    abstract: "List key-paths completing a partial key-path.")
+
+  @Argument(help: "Partial key-path to complete, ignoring case.")
+  var keyPath: String = ""
+
+  @Option(help: "Maximum completions to list.")
+  var limit: Int = 100
+
+  mutating func run(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB
+  ) throws -> Bool {
+    // Complete within the device named by the namespace prefix, if any, and
+    // keep the prefix on the completions.
+    let (namespace, keyPath) = SVD2LLDB.splitNamespace(self.keyPath)
+    let index = try context.loadedDevice(namespace: namespace, result: &result)
+      .completionIndex
+    let prefix = namespace.map { "\($0)\(SVD2LLDB.namespaceSeparator)" } ?? ""
+
+    let completions = index.completions(of: keyPath, limit: self.limit)
+    guard !completions.isEmpty else {
+      result.error("No completions for “\(self.keyPath)”.")
+      return false
+    }
+    result.output(completions.map { prefix + $0 }.joined(separator: "\n"))
+    return true
+  }
+}
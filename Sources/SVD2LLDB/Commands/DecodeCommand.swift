@@ -43,11 +43,22 @@ struct DecodeCommand: SVD2LLDBCommand {
     result: inout some SVD2LLDBResult,
     context: SVD2LLDB
   ) throws -> Bool {
-    let device = try context.device.unwrap(or: NoSVDLoadedError())
-    let info = try self.lookupRegister(item: device)
-    let value = try self.value(debugger: &debugger, info: info)
-
-    result.output("\(info.name): \(hex: value, bits: info.size)")
+    var keyPaths = [self.keyPath]
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &keyPaths, unique: true, result: &result)
+    self.keyPath = keyPaths[0]
+    let info = try context.statistics.measure(.resolution) {
+      try self.lookupRegister(index: index)
+    }
+    context.registerValueCache.synchronize(stopID: debugger.stopID())
+    let value = try self.value(
+      debugger: &debugger,
+      cache: context.registerValueCache,
+      info: info)
+
+    let span = context.statistics.begin(.rendering)
+    defer { context.statistics.end(span) }
+    result.output("\(info.name): \(value)")
     result.output("\n")
     if visual {
       self.renderVisual(
@@ -70,71 +81,69 @@ struct DecodeCommand: SVD2LLDBCommand {
     var size: UInt64
   }
 
-  func lookupRegister(item: any SVDItem) throws -> RegisterInfo {
-    // Split the first argument by "."s into a key path and normalize by
-    // lowercasing keys.
-    var keyPath = self.keyPath.split(separator: ".").map { $0.lowercased() }
+  func lookupRegister(index: DeviceIndex) throws -> RegisterInfo {
+    // Split the first argument by "."s into a key path.
+    let keyPath = self.keyPath.split(separator: ".")
     guard !keyPath.isEmpty else {
       throw ValidationError("Invalid key path “\(self.keyPath)”.")
     }
 
-    // Find the user requested item in device. While searching, normalize the
-    // key path name and determine metadata about the register.
-    var item = item
-    var name = ""
-    var readAction = item.readAction
-    var address = item.addressOffset
-    var size = item.registerProperties.size ?? 0
-    // Flip the keyPath so we pop from the back O(1) instead of the front O(N).
-    keyPath.reverse()
-    while let key = keyPath.last {
-      defer { keyPath.removeLast() }
-      guard let childItem = item.child(at: key) else {
-        throw GenericError("Unknown item “\(self.keyPath)”.")
-      }
-
-      if !name.isEmpty {
-        name.append(".")
-      }
-      name.append(childItem.name)
-      item = childItem
-      readAction = childItem.readAction ?? readAction
-      address = childItem.addressOffset + address
-      size = childItem.registerProperties.size ?? size
+    // Find the user requested item in the device index, which holds the
+    // normalized name and metadata about the register.
+    guard let node = index.node(at: keyPath) else {
+      throw GenericError("Unknown item “\(self.keyPath)”.")
     }
+    let name = index.keyPath(of: node)
 
     // Error if the item was found but isn't a register.
-    guard let register = item as? SVDRegister else {
+    guard let register = index.register(of: node) else {
       throw GenericError("Invalid register key path “\(name)”.")
     }
+    let size = index.nodes[node].size
 
-    // Error if the register is too large to handle.
-    let sizeSingular = size == 1
-    guard size <= 64 else {
-      throw GenericError(
-        "Invalid register size “\(size)“ bit\(sizeSingular ? "" : "s").")
+    // Error if the register is empty. Registers wider than 64 bits are read
+    // and decoded as multi-word values.
+    guard size > 0 else {
+      throw GenericError("Invalid register size “\(size)“ bits.")
     }
 
     return RegisterInfo(
       register: register,
       name: name,
-      readAction: readAction,
-      address: address,
+      readAction: index.nodes[node].readAction,
+      address: index.nodes[node].address,
       size: size)
   }
 
   func value(
     debugger: inout some SVD2LLDBDebugger,
+    cache: RegisterValueCache,
     info: RegisterInfo
-  ) throws -> UInt64 {
+  ) throws -> WideValue {
     if let userValue = self.value {
-      // Parse the value into a UInt64, if provided.
-      guard let value = SwiftIntegerParser<UInt64>().parseAll(userValue) else {
+      // Parse the value into a UInt64, or multiple words for registers wider
+      // than 64 bits, if provided.
+      let value: WideValue?
+      let valid: Bool
+      if info.size <= 64 {
+        let parsed = SwiftIntegerParser<UInt64>().parseAll(userValue)
+        valid = parsed != nil
+        value = parsed.flatMap {
+          ($0 >> info.size) == 0 ? WideValue(words: [$0], bits: info.size) : nil
+        }
+      } else {
+        // Wide values must be hexadecimal, parse them without a size limit to
+        // tell values which are too large from malformed values.
+        let digits = UInt64(userValue.utf8.count) * 4
+        valid = WideValue(parsing: userValue, bits: max(digits, 1)) != nil
+        value = WideValue(parsing: userValue, bits: info.size)
+      }
+      guard valid else {
         throw ValidationError("Invalid value “\(userValue)”.")
       }
       // Error if the user provided value exceeds the size of the register.
       let sizeSingular = info.size == 1
-      guard (value >> info.size) == 0 else {
+      guard let value else {
         throw GenericError(
           """
           Invalid value “\(userValue)“ larger than register size \
@@ -152,11 +161,32 @@ struct DecodeCommand: SVD2LLDBCommand {
           register.
           """)
       }
+      // Read registers wider than 64 bits whole with a single block read.
+      if info.size > 64 {
+        do {
+          let bytes = try debugger.read(
+            address: info.address,
+            count: Int(info.size.roundUp(toMultipleOf: 8) / 8))
+          return WideValue(bytes: bytes, bits: info.size)
+        } catch {
+          throw GenericError("Failed to read register: \(error)")
+        }
+      }
+      // Use the cached value of registers without side-effects if present.
+      if info.readAction == nil,
+        let value = cache[address: info.address, bits: info.size]
+      {
+        return WideValue(words: [value], bits: info.size)
+      }
       // Read the value from the register.
       do {
-        return try debugger.read(
+        let value = try debugger.read(
           address: info.address,
           bits: Int(info.size))
+        if info.readAction == nil {
+          cache[address: info.address, bits: info.size] = value
+        }
+        return WideValue(words: [value], bits: info.size)
       } catch {
         throw GenericError("Failed to read register: \(error)")
       }
@@ -172,7 +202,7 @@ extension DecodeCommand {
   func renderVisual(
     register: SVDRegister,
     size: UInt64,
-    value: UInt64,
+    value: WideValue,
     result: inout some SVD2LLDBResult
   ) {
     // Allocate rows to store field names into. The 0th row is the base of each
@@ -253,7 +283,7 @@ extension DecodeCommand {
     for line in above.reversed() {
       result.output(line)
     }
-    result.output("\(binary: value, bits: Int(size), segmented: false)")
+    result.output("\(binary: value.words, bits: Int(size), segmented: false)")
     for line in below {
       result.output(line)
     }
@@ -266,15 +296,58 @@ extension DecodeCommand {
     var valueName: String?
   }
 
+  /// A field of a register rendered as a row of the table.
+  struct TableField {
+    var name: String
+    var bitRange: Range<UInt64>
+    var enumeratedValues: SVDEnumeration?
+  }
+
   func renderTable(
     register: SVDRegister,
+    value: WideValue,
+    result: inout some SVD2LLDBResult
+  ) {
+    let fields = (register.fields?.field ?? []).map {
+      TableField(
+        name: $0.name,
+        bitRange: $0.bitRange.range,
+        enumeratedValues: $0.enumeratedValues)
+    }
+    Self.renderTable(
+      fields: fields,
+      value: value,
+      binary: self.binary,
+      indent: 0,
+      result: &result)
+  }
+
+  static func renderTable(
+    fields: [TableField],
     value: UInt64,
+    binary: Bool,
+    indent: Int,
+    result: inout some SVD2LLDBResult
+  ) {
+    Self.renderTable(
+      fields: fields,
+      value: WideValue(words: [value], bits: 64),
+      binary: binary,
+      indent: indent,
+      result: &result)
+  }
+
+  static func renderTable(
+    fields: [TableField],
+    value: WideValue,
+    binary: Bool,
+    indent: Int,
     result: inout some SVD2LLDBResult
   ) {
     // We want the rows to match the visual order of the bits in the hex value
     // printed above, so sort the fields by highest msb first.
-    let fields = (register.fields?.field ?? []).sorted {
-      $0.bitRange.range.upperBound > $1.bitRange.range.upperBound
+    let fields = fields.sorted {
+      $0.bitRange.upperBound > $1.bitRange.upperBound
     }
 
     // Walk through the fields once to compute the longest rendered bit range
@@ -286,39 +359,42 @@ extension DecodeCommand {
     var rows: [FieldRow] = []
     for field in fields {
 
-      let range = field.bitRange.range
-      let value = value[bits: range]
-
-      var valueName: String?
-      var defaultValueName: String?
-      for enumeratedValue in field.enumeratedValues?.enumeratedValue ?? [] {
-        switch enumeratedValue.data {
-        case .value(let data):
-          let mask = data.value.mask[bits: range]
-          if (value & mask) == data.value.value {
-            valueName = enumeratedValue.name
-            // FIXME: this doesn't handle read vs write enumerated value
-            break
+      let range = field.bitRange
+      // Skip fields which do not fit in the register's value.
+      guard range.upperBound <= value.capacity else { continue }
+
+      // Slice the field's value, which may itself be wider than 64 bits.
+      // Enumerated values only describe fields of at most 64 bits.
+      let valueString: String
+      let valueName: String?
+      if range.count <= 64 {
+        let value = value[bits: range]
+        valueString =
+          if binary {
+            "\(binary: value, bits: range.count)"
+          } else {
+            "\(hex: value, bits: range.count)"
           }
-        case .isDefault(let data):
-          if data.isDefault {
-            defaultValueName = enumeratedValue.name
+        valueName = Self.valueName(
+          of: value,
+          bitRange: range,
+          enumeratedValues: field.enumeratedValues)
+      } else {
+        let value = value.slice(bits: range)
+        valueString =
+          if binary {
+            "\(binary: value.words, bits: range.count)"
+          } else {
+            "\(value)"
           }
-        }
+        valueName = nil
       }
 
-      let valueString: String =
-        if self.binary {
-          "\(binary: value, bits: range.count)"
-        } else {
-          "\(hex: value, bits: range.count)"
-        }
-
       let row = FieldRow(
         bitRange: "[\(range.upperBound - 1):\(range.lowerBound)]",
         name: field.name,
         value: valueString,
-        valueName: valueName ?? defaultValueName)
+        valueName: valueName)
       longestBitRangePrefix = max(row.bitRange.count, longestBitRangePrefix)
       longestNamePrefix = max(row.name.count, longestNamePrefix)
       longestValuePrefix = max(row.value.count, longestValuePrefix)
@@ -327,7 +403,7 @@ extension DecodeCommand {
 
     // Render the rows.
     for row in rows {
-      var description = ""
+      var description = String(repeating: " ", count: indent)
       do {
         // Add one for a trailing space separating the columns.
         let trailingPadding = longestBitRangePrefix - row.bitRange.count + 1
@@ -360,4 +436,31 @@ extension DecodeCommand {
       result.output(description)
     }
   }
+
+  /// Returns the name of the enumerated value matching the value of a field,
+  /// falling back to the default enumerated value if none match.
+  static func valueName(
+    of value: UInt64,
+    bitRange range: Range<UInt64>,
+    enumeratedValues: SVDEnumeration?
+  ) -> String? {
+    var valueName: String?
+    var defaultValueName: String?
+    for enumeratedValue in enumeratedValues?.enumeratedValue ?? [] {
+      switch enumeratedValue.data {
+      case .value(let data):
+        let mask = data.value.mask[bits: range]
+        if (value & mask) == data.value.value {
+          valueName = enumeratedValue.name
+          // FIXME: this doesn't handle read vs write enumerated value
+          break
+        }
+      case .isDefault(let data):
+        if data.isDefault {
+          defaultValueName = enumeratedValue.name
+        }
+      }
+    }
+    return valueName ?? defaultValueName
+  }
 }
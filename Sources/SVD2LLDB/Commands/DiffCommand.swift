@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import MMIOUtilities
+
+struct DiffCommand: SVD2LLDBCommand {
+  static let autoRepeat = ""
+  static let configuration = CommandConfiguration(
+    commandName: "diff",
+    _superCommandName: "svd",
+    abstract: "Compare register values with a snapshot.")
+
+  @Argument(help: "Path to snapshot file.")
+  var path: String
+
+  @Argument(help: "Key-path to a peripheral, cluster, register, or field.")
+  var keyPath: [String] = []
+
+  @Option(
+    help: .init(
+      "Snapshot to compare against instead of the target.",
+      valueName: "path"))
+  var against: String?
+
+  mutating func run(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB
+  ) throws -> Bool {
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &self.keyPath, result: &result)
+    let old = try SnapshotCommand.load(path: self.path, index: index)
+    let (requestedReads, unknownKeyPaths) =
+      try SnapshotCommand.scheduleReads(keyPaths: self.keyPath, index: index)
+    var scheduledReads = requestedReads
+
+    // Compare against a second snapshot or the current register values.
+    let new: RegisterSnapshot
+    var failures: [UInt64] = []
+    if let against = self.against {
+      new = try SnapshotCommand.load(path: against, index: index)
+    } else {
+      // Without key paths only read the registers stored in the snapshot, so
+      // comparing against a partial snapshot does not report every other
+      // register as missing from it.
+      if self.keyPath.isEmpty {
+        scheduledReads.unscheduleRegisters(notIn: old)
+      }
+      let capture = SnapshotCommand.capture(
+        scheduledReads: &scheduledReads,
+        debugger: &debugger,
+        context: context,
+        index: index)
+      new = capture.0
+      failures = capture.1
+    }
+
+    // Scan the whole snapshots at once, then drop the registers which were
+    // not requested or could not be read.
+    var differences = old.differences(to: new)
+    if !self.keyPath.isEmpty || !failures.isEmpty {
+      let addresses = Set(scheduledReads.reads.map(\.address))
+        .subtracting(failures)
+      differences.removeAll { !addresses.contains($0.address) }
+    }
+
+    // Registers may share an address, display all of them.
+    var registers: [UInt64: [Int]] = [:]
+    for register in scheduledReads.scheduledRegisters.sorted() {
+      registers[index.nodes[register].address, default: []].append(register)
+    }
+
+    let valueTree = self.valueTree(
+      index: index,
+      registers: registers,
+      differences: differences)
+
+    if !failures.isEmpty {
+      result.warning(
+        """
+        Failed to read \(failures.count) \
+        register\(failures.count == 1 ? "" : "s"), these registers are not \
+        compared.
+        """)
+    }
+    if !valueTree.hasChildren(ValueTree.root) && unknownKeyPaths.isEmpty {
+      result.output("No differences.")
+      return true
+    }
+
+    // Render the tree to the user, return false if errors occurred.
+    return ReadCommand.render(
+      result: &result,
+      unknownKeyPaths: unknownKeyPaths,
+      valueTree: valueTree)
+  }
+
+  /// Builds a value tree of the changed registers and fields, naming the
+  /// enumerated values of changed fields.
+  func valueTree(
+    index: DeviceIndex,
+    registers: [UInt64: [Int]],
+    differences: [RegisterSnapshot.Difference]
+  ) -> ValueTree {
+    var tree = ReadCommand.ScheduledReads(index: index, force: false)
+    for difference in differences {
+      for register in registers[difference.address, default: []] {
+        let node = index.nodes[register]
+        let registerNode = tree.valueTreeNode(for: register)
+        tree.valueTree.values[registerNode] = .changed(
+          .init(old: difference.old, new: difference.new, bits: node.size))
+
+        // Fields are only compared if the register is in both snapshots.
+        guard let old = difference.old, let new = difference.new else {
+          continue
+        }
+        for field in node.children {
+          guard let range = index.nodes[field].bitRange else { continue }
+          let oldValue = old[bits: range]
+          let newValue = new[bits: range]
+          guard oldValue != newValue else { continue }
+          let enumeratedValues =
+            index.fields[index.nodes[field].item].enumeratedValues
+          let fieldNode = tree.valueTreeNode(for: field)
+          tree.valueTree.values[fieldNode] = .changed(
+            .init(
+              old: oldValue,
+              new: newValue,
+              bits: UInt64(range.count),
+              oldName: DecodeCommand.valueName(
+                of: oldValue,
+                bitRange: range,
+                enumeratedValues: enumeratedValues),
+              newName: DecodeCommand.valueName(
+                of: newValue,
+                bitRange: range,
+                enumeratedValues: enumeratedValues)))
+        }
+      }
+    }
+    return tree.valueTree
+  }
+}
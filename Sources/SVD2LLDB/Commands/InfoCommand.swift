@@ -31,36 +31,52 @@ struct InfoCommand: SVD2LLDBCommand {
     result: inout some SVD2LLDBResult,
     context: SVD2LLDB
   ) throws -> Bool {
-    let device = try context.device.unwrap(or: NoSVDLoadedError())
-
-    // Coalesce requested info key paths into a prefix tree.
-    let prefixTree = PrefixTree(element: device.name.lowercased())
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &self.keyPath, result: &result)
+
+    // Resolve each requested key path pattern to the matching items in the
+    // device index, keeping the order of the arguments and dropping items
+    // requested more than once.
+    let resolution = context.statistics.begin(.resolution)
+    var error = false
+    var nodes: [Int] = []
+    var visited: Set<Int> = []
+    var unknownKeyPaths: [String] = []
     for argument in self.keyPath {
-      // Split the argument by "."s into a key path and normalize by lowercasing
-      // keys.
-      let keyPath = argument.split(separator: ".").map { $0.lowercased() }
+      let matches: [Int]
       // Note: 0 item key paths are allowed for this command, to allow users to
       // request info about the top level device.
-      // Insert the key path into the prefix tree.
-      prefixTree.insert(source: argument, sequence: keyPath)
+      if argument.split(separator: ".").isEmpty {
+        matches = [DeviceIndex.root]
+      } else if let pattern = KeyPathPattern(argument) {
+        matches = index.nodes(matching: pattern)
+      } else {
+        result.error("Invalid key path “\(argument)”.")
+        error = true
+        continue
+      }
+      if matches.isEmpty {
+        unknownKeyPaths.append(argument)
+      }
+      for node in matches where visited.insert(node).inserted {
+        nodes.append(node)
+      }
     }
 
-    let info = self.recursiveInfo(
-      debugger: &debugger,
-      result: &result,
-      context: .init(
-        prefixTree: prefixTree,
-        item: device,
-        name: "",
-        registerProperties: device.registerProperties,
-        address: device.addressOffset))
-
-    // Render the tree to the user, return false if errors occurred.
-    return self.render(
-      result: &result,
-      device: device,
-      prefixTree: prefixTree,
-      info: info)
+    let info = nodes.map { node in
+      Info(name: index.keyPath(of: node), properties: index.info(of: node))
+    }
+    context.statistics.end(resolution)
+
+    // Render the info to the user, return false if errors occurred.
+    let rendered = context.statistics.measure(.rendering) {
+      self.render(
+        result: &result,
+        device: index.nodes[DeviceIndex.root].name,
+        unknownKeyPaths: unknownKeyPaths,
+        info: info)
+    }
+    return rendered && !error
   }
 
   struct Info {
@@ -68,67 +84,10 @@ struct InfoCommand: SVD2LLDBCommand {
     var properties: [(String, String)]
   }
 
-  struct RecursiveInfoContext {
-    var prefixTree: PrefixTree<String>
-    var item: any SVDItem
-    var name: String
-    var registerProperties: SVDRegisterProperties
-    var address: UInt64
-  }
-
-  mutating func recursiveInfo(
-    debugger: inout some SVD2LLDBDebugger,
-    result: inout some SVD2LLDBResult,
-    context: RecursiveInfoContext
-  ) -> [Info] {
-    // DFS through the SVD tree using the prefix tree as a needle to trim the
-    // search space.
-    var queue = [context]
-    var info: [Info] = []
-    while let context = queue.last {
-      queue.removeLast()
-
-      if context.prefixTree.source != nil {
-        info.append(
-          .init(
-            name: context.name,
-            properties: context.item.info(
-              registerProperties: context.registerProperties,
-              address: context.address)))
-        context.prefixTree.source = nil
-      }
-
-      for childItem in context.item.children() {
-        // do filtering, must find match in tree to continue search.
-        let childPrefixTree = context.prefixTree.children
-          .first { $0.element.matches(childItem.name) }
-        guard let childPrefixTree = childPrefixTree else { continue }
-        let childName =
-          if context.name.isEmpty {
-            childItem.name
-          } else {
-            "\(context.name).\(childItem.name)"
-          }
-        let childRegisterProperties = childItem.registerProperties
-          .merging(context.registerProperties)
-        let childAddress = childItem.addressOffset + context.address
-        queue.append(
-          .init(
-            prefixTree: childPrefixTree,
-            item: childItem,
-            name: childName,
-            registerProperties: childRegisterProperties,
-            address: childAddress))
-      }
-    }
-
-    return info
-  }
-
   mutating func render(
     result: inout some SVD2LLDBResult,
-    device: SVDDevice,
-    prefixTree pt: PrefixTree<String>,
+    device: String,
+    unknownKeyPaths: [String],
     info: [Info]
   ) -> Bool {
     // Walk the info list once to determine the length of the longest property
@@ -154,7 +113,7 @@ struct InfoCommand: SVD2LLDBCommand {
       if info.name != "" {
         result.output("\(info.name):")
       } else {
-        result.output("\(device.name):")
+        result.output("\(device):")
       }
       for property in info.properties {
         var description = "  \(property.0):"
@@ -165,22 +124,12 @@ struct InfoCommand: SVD2LLDBCommand {
       }
     }
 
-    // Walk the prefix tree looking for sources that have not been set to nil,
-    // indicating the matching item in the device tree was not found. Emit an
-    // error for each source without a match.
-    var unknown = false
-    do {
-      var queue = [pt]
-      while let pt = queue.last {
-        // FIXME: use Deque instead of Array as Stack
-        queue.removeLast()
-        if let source = pt.source {
-          result.error("Unknown item “\(source)”.")
-          unknown = true
-        }
-        queue.append(contentsOf: pt.children)
-      }
+    // Emit an error for each key path which did not match any items in the
+    // device.
+    for keyPath in unknownKeyPaths {
+      result.error("Unknown item “\(keyPath)”.")
     }
+    let unknown = !unknownKeyPaths.isEmpty
 
     return !unknown
   }
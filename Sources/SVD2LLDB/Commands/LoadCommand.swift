@@ -23,6 +23,23 @@ struct LoadCommand: SVD2LLDBCommand {
   @Argument(help: "Path to SVD file.")
   var path: String
 
+  @Option(
+    help: .init(
+      "Namespace to load the device into, defaults to the file name.",
+      valueName: "name"))
+  var namespace: String?
+
+  mutating func validate() throws {
+    if let namespace = self.namespace {
+      guard
+        !namespace.isEmpty,
+        !namespace.contains(SVD2LLDB.namespaceSeparator)
+      else {
+        throw ValidationError("Invalid namespace “\(namespace)”.")
+      }
+    }
+  }
+
   mutating func run(
     debugger: inout some SVD2LLDBDebugger,
     result: inout some SVD2LLDBResult,
@@ -30,16 +47,36 @@ struct LoadCommand: SVD2LLDBCommand {
   ) throws -> Bool {
     // Convert the file path to a url.
     let url = URL(fileURLWithPath: self.path)
-    // Load input file from disk.
-    let data = try Data(contentsOf: url)
-    // Decode raw data into SVD types.
-    var device = try SVDDevice(data: data)
-    // Inflate the decoded device.
-    try device.inflate()
-    // Save the device into plugin memory
-    context.device = device
-    // Report success to the user.
-    result.output("Loaded SVD file: “\(url.lastPathComponent)”.")
+    // Fail early if the file does not exist instead of on first use.
+    guard FileManager.default.fileExists(atPath: url.path) else {
+      throw GenericError("No such file “\(self.path)”.")
+    }
+    let namespace = (self.namespace ?? SVD2LLDB.namespace(of: url))
+      .lowercased()
+    // Watched registers belong to the previously selected device.
+    context.registerWatch = nil
+    // Reuse the device already loaded in the namespace if the file has not
+    // changed, so switching between devices does not parse them again.
+    if let load = context.devices[namespace],
+      load.source == DeviceLoad.Source(url: url)
+    {
+      context.selectedNamespace = namespace
+      result.output(
+        """
+        Using loaded SVD file: “\(url.lastPathComponent)” \
+        (namespace “\(namespace)”).
+        """)
+      return true
+    }
+    // Read, decode, and inflate the device on a background thread. Commands
+    // which need the device wait for the load to complete.
+    context.add(DeviceLoad(url: url), namespace: namespace)
+    // Report progress to the user.
+    result.output(
+      """
+      Loading SVD file: “\(url.lastPathComponent)” \
+      (namespace “\(namespace)”).
+      """)
     // Return success.
     return true
   }
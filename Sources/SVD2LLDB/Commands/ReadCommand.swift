@@ -26,234 +26,150 @@ struct ReadCommand: SVD2LLDBCommand {
   @Flag(help: "Always read ignoring side-effects.")
   var force: Bool = false
 
+  @Option(
+    help: .init(
+      "Largest gap to read between registers.",
+      valueName: "bytes"))
+  var maxGap: UInt64 = ReadPlan.Options.default.maximumGap
+
+  @Option(
+    name: .customLong("max-block"),
+    help: .init(
+      "Largest bulk memory read.",
+      valueName: "bytes"))
+  var maxBlockSize: UInt64 = ReadPlan.Options.default.maximumBlockSize
+
   mutating func run(
     debugger: inout some SVD2LLDBDebugger,
     result: inout some SVD2LLDBResult,
     context: SVD2LLDB
   ) throws -> Bool {
-    let device = try context.device.unwrap(or: NoSVDLoadedError())
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &self.keyPath, result: &result)
 
-    // Coalesce requested reads into a prefix tree.
+    // Resolve each requested key path pattern to the matching items in the
+    // device index and schedule reads of the registers beneath them, building
+    // the register value tree along the way.
+    let resolution = context.statistics.begin(.resolution)
     var error = false
-    let prefixTree = PrefixTree(element: device.name.lowercased())
+    var unknownKeyPaths: [String] = []
+    var scheduledReads = ScheduledReads(index: index, force: self.force)
     for argument in self.keyPath {
-      // Split the argument by "."s into a key path and normalize by lowercasing
-      // keys.
-      let keyPath = argument.split(separator: ".").map { $0.lowercased() }
-      // Skip key paths with no items.
-      guard !keyPath.isEmpty else {
+      // Skip key paths with no items or malformed patterns.
+      guard let pattern = KeyPathPattern(argument) else {
         result.error("Invalid key path “\(argument)”.")
         error = true
         continue
       }
-      // Insert the key path into the prefix tree.
-      prefixTree.insert(source: argument, sequence: keyPath)
+      let nodes = index.nodes(matching: pattern)
+      if nodes.isEmpty {
+        unknownKeyPaths.append(argument)
+      }
+      for node in nodes {
+        scheduledReads.request(node: node)
+      }
+    }
+    context.statistics.end(resolution)
+
+    // Perform the scheduled reads not found in the register value cache as a
+    // batch of coalesced memory transactions and populate the value tree with
+    // the results.
+    context.registerValueCache.synchronize(stopID: debugger.stopID())
+    context.statistics.measure(.planning) {
+      scheduledReads.execute(
+        debugger: &debugger,
+        cache: context.registerValueCache,
+        options: .init(
+          maximumGap: self.maxGap,
+          maximumBlockSize: self.maxBlockSize))
     }
-
-    // Read the values request by the prefix tree into the register value tree
-    // using the device tree to find metadata to determine where/how to read.
-    //
-    // e.g. needle: prefixTree, haystack: device, result: valueTree.
-    let valueTree = ValueTree.container(name: device.name)
-    self.recursiveRead(
-      debugger: &debugger,
-      result: &result,
-      context: .init(
-        prefixTree: prefixTree,
-        item: device,
-        valueTree: valueTree,
-        readAction: device.readAction,
-        address: device.addressOffset,
-        size: device.registerProperties.size ?? 0))
 
     // Render the tree to the user, return false if read errors occurred.
-    return self.render(
-      result: &result,
-      prefixTree: prefixTree,
-      valueTree: valueTree) && !error
+    let rendered = context.statistics.measure(.rendering) {
+      Self.render(
+        result: &result,
+        unknownKeyPaths: unknownKeyPaths,
+        valueTree: scheduledReads.valueTree)
+    }
+    return rendered && !error
   }
 
-  struct RecursiveReadContext {
-    var prefixTree: PrefixTree<String>?
-    var item: any SVDItem
+  struct ScheduledReads {
+    struct Field {
+      var node: Int
+      var register: Int
+      var range: Range<UInt64>
+    }
+
+    var index: DeviceIndex
+    var force: Bool
+    /// The value tree of the requested items, populated once read.
     var valueTree: ValueTree
-    var readAction: SVDReadAction?
-    var address: UInt64
-    var size: UInt64
+    /// Value tree nodes keyed by their device index node.
+    var valueTreeNodes: [Int: Int]
+    var scheduledRegisters: Set<Int> = []
+
+    /// The value tree nodes of the scheduled registers, in read order.
+    var registers: [Int] = []
+    var reads: [ReadPlan.Read] = []
+    var fields: [Field] = []
+    /// Address ranges of skipped registers which must not be read.
+    var barriers: [Range<UInt64>] = []
+
+    init(index: DeviceIndex, force: Bool) {
+      self.index = index
+      self.force = force
+      self.valueTree = ValueTree(name: index.nodes[DeviceIndex.root].name)
+      self.valueTreeNodes = [DeviceIndex.root: ValueTree.root]
+    }
   }
 
-  mutating func recursiveRead(
-    debugger: inout some SVD2LLDBDebugger,
-    result: inout some SVD2LLDBResult,
-    context: RecursiveReadContext
-  ) {
-    // DFS through the SVD tree using the prefix tree as a needle to trim the
-    // search space.
-    var queue = [context]
-    while let context = queue.last {
-      queue.removeLast()
-
-      // If the current item is a register or field it is readable.
-      let isReadable = context.item is SVDRegister || context.item is SVDField
-      // Note if the value for this item has already been read. We dont want to
-      // read a register multiple times. This can occur if a user requests
-      // "Reg" and "Reg.Field".
-      let hasBeenRead = context.valueTree.value != nil
-      // Read the value if the item is readable and hasn't already been read.
-      if isReadable, !hasBeenRead {
-        context.valueTree.value = self.read(
-          debugger: &debugger,
-          readAction: context.readAction,
-          address: context.address,
-          size: context.size)
-      }
+  static let skippedWarning = """
+    Skipped registers with side-effects. Use “--force” to read these \
+    registers.
+    """
 
-      // If the current item is a field we need to extract its value from the
-      // parent register and insert a new node into the value tree.
-      //
-      // Unlike all other SVD items, fields are not inserted into the register
-      // value tree during the child recursive descent.
-      if let field = context.item as? SVDField {
-        let value: ValueTree.Value?
-        if case .data(let data, _) = context.valueTree.value {
-          // If we successfully read the register this field is found in, slice
-          // the field's value from the register's value.
-          let range = field.bitRange.range
-          value = .data(data[bits: range], UInt64(range.count))
-        } else {
-          // If the read was skipped or errored, just copy that status from the
-          // register's value to the field's value.
-          value = context.valueTree.value
-        }
-        // Add the sliced or copied value from the register and store it in a
-        // new value tree node.
-        context.valueTree.children.append(
-          .init(name: field.name, value: value, children: []))
-      }
+  static let unmappedWarning = """
+    Skipped registers outside the address blocks of their peripheral. Use \
+    “--force” to read these registers.
+    """
 
-      // Record if the user specifically requested this node and nil-out the
-      // source in the prefix tree if present.
-      let userRequested =
-        if let prefixTree = context.prefixTree {
-          prefixTree.source != nil
-        } else {
-          false
-        }
-      context.prefixTree?.source = nil
-
-      for childItem in context.item.children() {
-        // The child matching logic is a bit confusing, so lets describe the
-        // idea here first.
-        //
-        // The prefix tree contains all user supplied arguments (key paths),
-        // broken up into keys. The terminal keys of the user arguments are
-        // marked with `source != nil`. Each of these nodes should be
-        // recursively searched down to register nodes (not to fields).
-        //
-        // A node can be marked as `source != nil` and also have children. This
-        // can happen in the case where the user manually specified a key and
-        // its parents. e.g. "Reg" (terminal) and "Reg.Field" (terminal).
-        //
-        // While reading values from the SVD tree its important we nil out
-        // `source` for user supplied arguments so we can later report user
-        // requested key paths that didn't match anything in the SVD tree.
-
-        var childPrefixTrees: [PrefixTree<String>?] = []
-        if let prefixTree = context.prefixTree {
-          // do filtering, must find match in tree to add node.
-          let childPrefixTree = (prefixTree.children as [PrefixTree<String>])
-            .first { $0.element.matches(childItem.name) }
-          if let childPrefixTree = childPrefixTree {
-            childPrefixTrees.append(childPrefixTree)
-          }
-        }
-
-        if userRequested || context.prefixTree == nil,
-          !(context.item is SVDRegister)
-        {
-          // If there is no prefix tree or user requested this node, that means
-          // we have entered the read everything phase of the tree walk. Add
-          // the child item to the search queue without a prefix tree if the
-          // current item is not a register.
-          childPrefixTrees.append(nil)
-        }
-
-        guard !childPrefixTrees.isEmpty else { continue }
-
-        // Unlike all other SVD items, fields are not inserted into the register
-        // value tree during the child recursive descent.
-        let childValueTree: ValueTree
-        if childItem is SVDField {
-          childValueTree = context.valueTree
-        } else {
-          childValueTree = ValueTree(
-            name: childItem.name,
-            value: nil,
-            children: [])
-          context.valueTree.children.append(childValueTree)
-        }
+  /// The largest amount of output, in bytes, passed to the result at once.
+  ///
+  /// Rows are streamed to the result in chunks of about this size so the
+  /// output of reading a whole device is never buffered in a single string.
+  static let outputChunkSize = 16 * 1024
 
-        let childReadAction = childItem.readAction ?? context.readAction
-        let childAddress = childItem.addressOffset + context.address
-        let childSize = childItem.registerProperties.size ?? context.size
-
-        // Add a child item to the queue for each child prefix tree.
-        for childPrefixTree in childPrefixTrees {
-          queue.append(
-            .init(
-              prefixTree: childPrefixTree,
-              item: childItem,
-              valueTree: childValueTree,
-              readAction: childReadAction,
-              address: childAddress,
-              size: childSize))
-        }
-      }
-    }
-  }
-
-  mutating func read(
-    debugger: inout some SVD2LLDBDebugger,
-    readAction: SVDReadAction?,
-    address: UInt64,
-    size: UInt64
-  ) -> ValueTree.Value {
-    do {
-      // Skip reading registers with side-effects unless forced.
-      guard readAction == nil || self.force else { return .skipped }
-      // Read the register.
-      let value = try debugger.read(address: address, bits: size)
-      return .data(value, size)
-    } catch {
-      return .error
-    }
-  }
-
-  mutating func render(
+  static func render(
     result: inout some SVD2LLDBResult,
-    prefixTree pt: PrefixTree<String>,
-    valueTree vt: ValueTree
+    unknownKeyPaths: [String],
+    valueTree vt: ValueTree,
+    skippedWarning: String = ReadCommand.skippedWarning,
+    outputChunkSize: Int = ReadCommand.outputChunkSize
   ) -> Bool {
-    // Walk the value tree once to compute the longest prefix so we can align
-    // the values in the output. Also note errored or skipped reads.
+    // Walk the value tree once to compute the indentation and width of each
+    // row's prefix so we can align the values in the output. Also note errored
+    // or skipped reads. Parents always precede their children in the arena, so
+    // a single forward pass computes the depth of every node.
+    var depths = [Int](repeating: 0, count: vt.count)
+    var prefixWidths = [Int](repeating: 0, count: vt.count)
     var longestPrefix = 0
     var data = false
     var skipped = false
+    var unmapped = false
     var error = false
-    do {
-      var queue = [(vt, 0)]
-      while let (vt, prefixCount) = queue.last {
-        queue.removeLast()
-        longestPrefix = max(vt.name.count + prefixCount, longestPrefix)
-        switch vt.value {
-        case .data: data = true
-        case .skipped: skipped = true
-        case .error: error = true
-        default: break
-        }
-        for child in vt.children {
-          queue.append((child, prefixCount + 2))
-        }
+    for node in 0..<vt.count {
+      if node != ValueTree.root {
+        depths[node] = depths[vt.parents[node]] + 2
+      }
+      prefixWidths[node] = depths[node] + vt.names[node].count
+      longestPrefix = max(prefixWidths[node], longestPrefix)
+      switch vt.values[node] {
+      case .data, .wideData, .changed, .notCaptured: data = true
+      case .skipped: skipped = true
+      case .unmapped: unmapped = true
+      case .error: error = true
+      default: break
       }
     }
 
@@ -261,60 +177,57 @@ struct ReadCommand: SVD2LLDBCommand {
     // tree while printing.
     longestPrefix += 2
 
-    // If the read value tree has any values, walk the tree and print them.
-    if data || skipped || error {
-      var description = ""
-      var queue = [(vt, 0)]
-      while let (vt, prefixCount) = queue.last {
-        queue.removeLast()
-        let trailingPadding = longestPrefix - prefixCount - vt.name.count - 1
-
-        if !description.isEmpty {
-          description.append("\n")
+    // If the read value tree has any values, walk the tree depth first and
+    // stream its rows to the result.
+    if data || skipped || unmapped || error {
+      var chunk = ""
+      var stack = [ValueTree.root]
+      while let node = stack.popLast() {
+        if !chunk.isEmpty {
+          chunk.append("\n")
         }
 
-        description.append(String(repeating: " ", count: prefixCount))
-        description.append(vt.name)
-        description.append(":")
+        chunk.append(repeating: " ", count: depths[node])
+        chunk.append(vt.names[node])
+        chunk.append(":")
 
-        if let value = vt.value {
-          description.append(String(repeating: " ", count: trailingPadding))
-          description.append("\(value)")
+        if let value = vt.values[node] {
+          let trailingPadding = longestPrefix - prefixWidths[node] - 1
+          chunk.append(repeating: " ", count: trailingPadding)
+          chunk.append("\(value)")
         }
 
-        // FIXME: this should be sorted by address/field offset
-        let children = vt.children.sorted { $0.name > $1.name }
-        for child in children {
-          queue.append((child, prefixCount + 2))
+        if chunk.utf8.count >= outputChunkSize {
+          result.output(chunk)
+          chunk.removeAll(keepingCapacity: true)
         }
+
+        // Children are displayed in address order, or bit offset order for
+        // fields, and are pushed in reverse so they are popped in order.
+        let start = stack.count
+        stack.append(contentsOf: vt.children(of: node))
+        stack[start...].sort { vt.precedes($1, $0) }
+      }
+      if !chunk.isEmpty {
+        result.output(chunk)
       }
-      result.output(description)
     }
 
-    // Walk the prefix tree looking for sources that have not been set to nil,
-    // indicating the matching item in the device tree was not found. Emit an
-    // error for each source without a match.
-    var unknown = false
-    do {
-      var queue = [pt]
-      while let pt = queue.last {
-        // FIXME: use Deque instead of Array as Stack
-        queue.removeLast()
-        if let source = pt.source {
-          result.error("Unknown item “\(source)”.")
-          unknown = true
-        }
-        queue.append(contentsOf: pt.children)
-      }
+    // Emit an error for each key path which did not match any items in the
+    // device.
+    for keyPath in unknownKeyPaths {
+      result.error("Unknown item “\(keyPath)”.")
     }
+    let unknown = !unknownKeyPaths.isEmpty
 
     // If any registers were skipped while reading, emit a warning.
     if skipped {
-      result.warning(
-        """
-        Skipped registers with side-effects. Use “--force” to read \
-        these registers.
-        """)
+      result.warning(skippedWarning)
+    }
+
+    // Likewise if any registers were skipped because they are not mapped.
+    if unmapped {
+      result.warning(Self.unmappedWarning)
     }
 
     if error {
@@ -324,3 +237,160 @@ struct ReadCommand: SVD2LLDBCommand {
     return !error && !unknown
   }
 }
+
+extension ReadCommand.ScheduledReads {
+  /// Schedules reads of the registers at or beneath an index node.
+  mutating func request(node: Int) {
+    switch self.index.nodes[node].kind {
+    case .field:
+      // Reading a field reads its register and only displays the field.
+      self.schedule(register: self.index.nodes[node].parent)
+      _ = self.valueTreeNode(for: node)
+    case .register:
+      self.schedule(register: node)
+    case .device, .peripheral, .cluster:
+      // Read every register beneath the container, but not their fields.
+      var queue = [node]
+      while let node = queue.popLast() {
+        _ = self.valueTreeNode(for: node)
+        for child in self.index.nodes[node].children {
+          switch self.index.nodes[child].kind {
+          case .register: self.schedule(register: child)
+          case .field: break
+          default: queue.append(child)
+          }
+        }
+      }
+    }
+  }
+
+  /// Returns the value tree node for an index node, inserting it and its
+  /// ancestors into the value tree if needed.
+  mutating func valueTreeNode(for node: Int) -> Int {
+    if let valueTreeNode = self.valueTreeNodes[node] { return valueTreeNode }
+    let parent = self.valueTreeNode(for: self.index.nodes[node].parent)
+    let indexNode = self.index.nodes[node]
+    let valueTreeNode = self.valueTree.append(
+      name: indexNode.name,
+      key: indexNode.bitRange?.lowerBound ?? indexNode.address,
+      parent: parent)
+    self.valueTreeNodes[node] = valueTreeNode
+
+    // Fields take their value from their parent register once it has been
+    // read.
+    if let range = indexNode.bitRange {
+      self.fields.append(
+        .init(node: valueTreeNode, register: parent, range: range))
+    }
+    return valueTreeNode
+  }
+
+  /// Schedules a register to be read unless it has already been scheduled.
+  ///
+  /// A register may be requested multiple times, for example if a user
+  /// requests "Reg" and "Reg.Field".
+  mutating func schedule(register node: Int) {
+    let valueTreeNode = self.valueTreeNode(for: node)
+    guard self.scheduledRegisters.insert(node).inserted else { return }
+
+    let register = self.index.nodes[node]
+    let byteCount = register.size.roundUp(toMultipleOf: 8) / 8
+    let range = register.address..<register.address + byteCount
+    let unmapped = self.index.unmappedRanges.mergedRangesOverlap(range)
+    if unmapped && !self.force {
+      // Skip reading registers outside the memory map of their peripheral
+      // unless forced, the unmapped range is already a barrier.
+      self.valueTree.values[valueTreeNode] = .unmapped
+    } else if register.readAction == nil || self.force {
+      self.registers.append(valueTreeNode)
+      self.reads.append(
+        .init(
+          address: register.address,
+          bits: register.size,
+          coalescable: register.readAction == nil && !unmapped))
+    } else {
+      // Skip reading registers with side-effects unless forced and prevent
+      // coalesced reads from reading through them.
+      self.valueTree.values[valueTreeNode] = .skipped
+      self.barriers.append(range)
+    }
+  }
+
+  mutating func execute(
+    debugger: inout some SVD2LLDBDebugger,
+    cache: RegisterValueCache,
+    options: ReadPlan.Options
+  ) {
+    // Only reads of registers without side-effects are coalescable, use the
+    // cached values of these registers where possible.
+    var values = [UInt64?](repeating: nil, count: self.reads.count)
+    var uncached = [Int]()
+    for (index, read) in self.reads.enumerated() {
+      if read.coalescable,
+        let value = cache[address: read.address, bits: read.bits]
+      {
+        values[index] = value
+      } else {
+        uncached.append(index)
+      }
+    }
+
+    // Never read through unmapped space or buffers to coalesce reads.
+    let plan = ReadPlan(
+      reads: uncached.map { self.reads[$0] },
+      barriers: self.barriers + self.index.unmappedRanges
+        + self.index.bufferRanges,
+      options: options)
+    var planWideValues: [Int: WideValue] = [:]
+    let planValues = plan.execute(
+      debugger: &debugger,
+      wideValues: &planWideValues)
+    for (index, value) in zip(uncached, planValues) {
+      values[index] = value
+      let read = self.reads[index]
+      if read.coalescable, let value {
+        cache[address: read.address, bits: read.bits] = value
+      }
+    }
+    // Registers wider than 64 bits are not cached.
+    var wideValues: [Int: WideValue] = [:]
+    for (planIndex, value) in planWideValues {
+      wideValues[uncached[planIndex]] = value
+    }
+
+    for (index, register) in self.registers.enumerated() {
+      self.valueTree.values[register] =
+        if let value = values[index] {
+          .data(value, self.reads[index].bits)
+        } else if let value = wideValues[index] {
+          .wideData(value)
+        } else {
+          .error
+        }
+    }
+
+    for field in self.fields {
+      let registerValue = self.valueTree.values[field.register]
+      if case .data(let data, _) = registerValue {
+        // If we successfully read the register this field is found in, slice
+        // the field's value from the register's value.
+        self.valueTree.values[field.node] = .data(
+          data[bits: field.range], UInt64(field.range.count))
+      } else if case .wideData(let data) = registerValue {
+        // Fields of wide registers may themselves be wider than 64 bits.
+        self.valueTree.values[field.node] =
+          if field.range.upperBound > data.bits {
+            .error
+          } else if field.range.count <= 64 {
+            .data(data[bits: field.range], UInt64(field.range.count))
+          } else {
+            .wideData(data.slice(bits: field.range))
+          }
+      } else {
+        // If the read was skipped or errored, just copy that status from the
+        // register's value to the field's value.
+        self.valueTree.values[field.node] = registerValue
+      }
+    }
+  }
+}
@@ -0,0 +1,265 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import Foundation
+
+struct SnapshotCommand: SVD2LLDBCommand {
+  static let autoRepeat = ""
+  static let configuration = CommandConfiguration(
+    commandName: "snapshot",
+    _superCommandName: "svd",
+    abstract: "Save or decode a snapshot of register values.")
+
+  enum Action: String, CaseIterable, ExpressibleByArgument {
+    case save
+    case decode
+  }
+
+  @Argument(help: "Action to perform.")
+  var action: Action
+
+  @Argument(help: "Path to snapshot file.")
+  var path: String
+
+  @Argument(help: "Key-path to a peripheral, cluster, register, or field.")
+  var keyPath: [String] = []
+
+  @Flag(help: "Include the fields of decoded registers.")
+  var fields: Bool = false
+
+  mutating func run(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB
+  ) throws -> Bool {
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &self.keyPath, result: &result)
+    switch self.action {
+    case .save:
+      return try self.save(
+        debugger: &debugger,
+        result: &result,
+        context: context,
+        index: index)
+    case .decode:
+      return try self.decode(result: &result, index: index)
+    }
+  }
+
+  /// Resolves the requested key paths, or the whole device if none were
+  /// requested, and schedules reads of the matching registers.
+  static func scheduleReads(
+    keyPaths: [String],
+    index: DeviceIndex
+  ) throws -> (ReadCommand.ScheduledReads, [String]) {
+    var unknownKeyPaths: [String] = []
+    var scheduledReads = ReadCommand.ScheduledReads(index: index, force: false)
+    if keyPaths.isEmpty {
+      scheduledReads.request(node: DeviceIndex.root)
+    }
+    for argument in keyPaths {
+      guard let pattern = KeyPathPattern(argument) else {
+        throw GenericError("Invalid key path “\(argument)”.")
+      }
+      let nodes = index.nodes(matching: pattern)
+      if nodes.isEmpty {
+        unknownKeyPaths.append(argument)
+      }
+      for node in nodes {
+        scheduledReads.request(node: node)
+      }
+    }
+    return (scheduledReads, unknownKeyPaths)
+  }
+
+  /// Reads the scheduled registers from the target, returning a snapshot of
+  /// their values and the addresses of the registers which failed to read.
+  static func capture(
+    scheduledReads: inout ReadCommand.ScheduledReads,
+    debugger: inout some SVD2LLDBDebugger,
+    context: SVD2LLDB,
+    index: DeviceIndex
+  ) -> (RegisterSnapshot, [UInt64]) {
+    // Read every register without side-effects using coalesced block reads.
+    // Registers with side-effects are never scheduled since reads are not
+    // forced, and registers wider than 64 bits are not stored.
+    _ = scheduledReads.unscheduleWideRegisters()
+    context.registerValueCache.synchronize(stopID: debugger.stopID())
+    scheduledReads.execute(
+      debugger: &debugger,
+      cache: context.registerValueCache,
+      options: .default)
+
+    var values: [UInt64: UInt64] = [:]
+    var failures: [UInt64] = []
+    let reads = zip(scheduledReads.registers, scheduledReads.reads)
+    for (register, read) in reads {
+      switch scheduledReads.valueTree.values[register] {
+      case .data(let value, _):
+        values[read.address] = value
+      default:
+        failures.append(read.address)
+      }
+    }
+    let snapshot = RegisterSnapshot(
+      fingerprint: index.fingerprint,
+      values: values)
+    return (snapshot, failures)
+  }
+
+  /// Reads a snapshot file, verifying it was taken from the loaded device.
+  static func load(
+    path: String,
+    index: DeviceIndex
+  ) throws -> RegisterSnapshot {
+    let data: Data
+    do {
+      data = try Data(contentsOf: URL(fileURLWithPath: path))
+    } catch {
+      throw GenericError("Failed to read snapshot “\(path)”: \(error)")
+    }
+    guard let snapshot = RegisterSnapshot(bytes: Array(data)) else {
+      throw GenericError("Invalid snapshot file “\(path)”.")
+    }
+    guard snapshot.fingerprint == index.fingerprint else {
+      throw GenericError(
+        """
+        Snapshot “\(path)” was not taken from device \
+        “\(index.nodes[DeviceIndex.root].name)”.
+        """)
+    }
+    return snapshot
+  }
+}
+
+extension SnapshotCommand {
+  func save(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB,
+    index: DeviceIndex
+  ) throws -> Bool {
+    let (requestedReads, unknownKeyPaths) = try Self.scheduleReads(
+      keyPaths: self.keyPath,
+      index: index)
+    var scheduledReads = requestedReads
+    let wide = scheduledReads.reads.contains { $0.bits > 64 }
+    guard unknownKeyPaths.isEmpty else {
+      for keyPath in unknownKeyPaths {
+        result.error("Unknown item “\(keyPath)”.")
+      }
+      return false
+    }
+
+    let (snapshot, failures) = Self.capture(
+      scheduledReads: &scheduledReads,
+      debugger: &debugger,
+      context: context,
+      index: index)
+    let url = URL(fileURLWithPath: self.path)
+    do {
+      try Data(snapshot.encoded()).write(to: url)
+    } catch {
+      throw GenericError("Failed to write snapshot “\(self.path)”: \(error)")
+    }
+
+    let count = snapshot.addresses.count
+    result.output(
+      """
+      Saved \(count) register\(count == 1 ? "" : "s") to \
+      “\(url.lastPathComponent)”.
+      """)
+    if wide {
+      result.warning(Self.wideWarning)
+    }
+    if !failures.isEmpty {
+      result.warning(
+        """
+        Failed to read \(failures.count) \
+        register\(failures.count == 1 ? "" : "s"), \
+        these registers are not included in the snapshot.
+        """)
+    }
+    return true
+  }
+
+  func decode(
+    result: inout some SVD2LLDBResult,
+    index: DeviceIndex
+  ) throws -> Bool {
+    let snapshot = try Self.load(path: self.path, index: index)
+    let (requestedReads, unknownKeyPaths) = try Self.scheduleReads(
+      keyPaths: self.keyPath,
+      index: index)
+    var scheduledReads = requestedReads
+    if self.fields {
+      for register in scheduledReads.scheduledRegisters {
+        for field in index.nodes[register].children {
+          scheduledReads.request(node: field)
+        }
+      }
+    }
+
+    // Serve the reads from the snapshot one register at a time. Registers
+    // wider than 64 bits are never saved, display them as not captured
+    // instead of failing to read them.
+    let wide = scheduledReads.unscheduleWideRegisters()
+    var debugger = RegisterSnapshot.Debugger(snapshot: snapshot)
+    scheduledReads.execute(
+      debugger: &debugger,
+      cache: RegisterValueCache(),
+      options: .init(maximumGap: 0, maximumBlockSize: 0))
+
+    let success = ReadCommand.render(
+      result: &result,
+      unknownKeyPaths: unknownKeyPaths,
+      valueTree: scheduledReads.valueTree,
+      skippedWarning: """
+        Registers with side-effects are not included in snapshots.
+        """)
+    if wide {
+      result.warning(Self.wideWarning)
+    }
+    return success
+  }
+
+  static let wideWarning = """
+    Registers wider than 64 bits are not included in snapshots.
+    """
+}
+
+extension ReadCommand.ScheduledReads {
+  /// Removes the scheduled reads of registers wider than 64 bits, which
+  /// snapshots do not store, and marks them as not captured.
+  ///
+  /// Returns whether any reads were removed.
+  mutating func unscheduleWideRegisters() -> Bool {
+    let kept = self.reads.indices.filter { self.reads[$0].bits <= 64 }
+    guard kept.count < self.reads.count else { return false }
+    for (index, read) in self.reads.enumerated() where read.bits > 64 {
+      self.valueTree.values[self.registers[index]] = .notCaptured
+    }
+    self.registers = kept.map { self.registers[$0] }
+    self.reads = kept.map { self.reads[$0] }
+    return true
+  }
+
+  /// Removes the scheduled reads of registers which are not stored in
+  /// `snapshot`.
+  mutating func unscheduleRegisters(notIn snapshot: RegisterSnapshot) {
+    let kept = self.reads.indices.filter {
+      snapshot.value(at: self.reads[$0].address) != nil
+    }
+    self.registers = kept.map { self.registers[$0] }
+    self.reads = kept.map { self.reads[$0] }
+  }
+}
@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import Foundation
+
+struct StatsCommand: SVD2LLDBCommand {
+  static let autoRepeat = ""
+  static let recordsStatistics = false
+  static let configuration = CommandConfiguration(
+    commandName: "stats",
+    _superCommandName: "svd",
+    abstract: "Report where time was spent by recent commands and loads.")
+
+  @Option(help: "Number of recent commands to report.")
+  var last: Int = 1
+
+  @Flag(help: "Discard the recorded commands after reporting them.")
+  var reset: Bool = false
+
+  @Option(
+    help: .init(
+      "Append a trace of every command and memory transaction to a file.",
+      valueName: "path"))
+  var trace: String?
+
+  @Flag(help: "Stop writing the trace log.")
+  var noTrace: Bool = false
+
+  mutating func validate() throws {
+    guard 0 < self.last, self.last <= CommandStatistics.capacity else {
+      throw ValidationError(
+        """
+        Invalid command count “\(self.last)”, must be between 1 and \
+        \(CommandStatistics.capacity).
+        """)
+    }
+    guard self.trace == nil || !self.noTrace else {
+      throw ValidationError("Cannot use “--trace” with “--no-trace”.")
+    }
+  }
+
+  mutating func run(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB
+  ) throws -> Bool {
+    let statistics = context.statistics
+
+    if self.noTrace {
+      statistics.trace = nil
+      result.output("Stopped tracing commands.")
+      return true
+    }
+    if let path = self.trace {
+      let url = URL(fileURLWithPath: path)
+      if !FileManager.default.fileExists(atPath: url.path) {
+        FileManager.default.createFile(atPath: url.path, contents: nil)
+      }
+      guard let handle = try? FileHandle(forWritingTo: url) else {
+        throw GenericError("Failed to open trace log “\(path)”.")
+      }
+      _ = handle.seekToEndOfFile()
+      statistics.trace = { line in
+        handle.write(Data("\(line)\n".utf8))
+      }
+      result.output("Tracing commands to “\(path)”.")
+      return true
+    }
+
+    // Report the most recent commands, oldest first.
+    let records = statistics.records.suffix(self.last)
+    if records.isEmpty {
+      result.output("No commands recorded.")
+    }
+    for record in records {
+      self.render(record: record, result: &result)
+    }
+    self.renderLoads(context: context, result: &result)
+
+    if self.reset {
+      statistics.reset()
+    }
+    return true
+  }
+
+  /// Renders a labeled row of a report, aligning the values of all rows.
+  func row(_ label: String, _ value: String, indent: Int) -> String {
+    // Leave two spaces after the longest label, “resolution:”.
+    var description = String(repeating: " ", count: indent)
+    description.append("\(label):")
+    description.append(repeating: " ", count: max(12 - label.count, 1))
+    description.append(value)
+    return description
+  }
+
+  func render(
+    record: CommandStatistics.Record,
+    result: inout some SVD2LLDBResult
+  ) {
+    result.output("\(record.command):")
+    var measured: UInt64 = 0
+    for phase in CommandStatistics.Phase.allCases {
+      let duration = record.durations[phase] ?? 0
+      measured += duration
+      var value = CommandStatistics.format(nanoseconds: duration)
+      if phase == .memory {
+        let transactions = record.transactions
+        let bytes = record.bytes
+        value.append(
+          """
+           (\(transactions) transaction\(transactions == 1 ? "" : "s"), \
+          \(bytes) byte\(bytes == 1 ? "" : "s"))
+          """)
+      }
+      result.output(self.row(phase.rawValue, value, indent: 2))
+    }
+    // Time not attributed to any phase, such as parsing arguments.
+    let other = record.total - min(measured, record.total)
+    result.output(
+      self.row(
+        "other", CommandStatistics.format(nanoseconds: other), indent: 2))
+    result.output(
+      self.row(
+        "total", CommandStatistics.format(nanoseconds: record.total),
+        indent: 2))
+  }
+
+  /// Renders the time spent in each phase of the loads of every namespace.
+  func renderLoads(
+    context: SVD2LLDB,
+    result: inout some SVD2LLDBResult
+  ) {
+    guard !context.devices.isEmpty else { return }
+    let phases: [DeviceLoad.Phase] = [
+      .reading, .decoding, .inflating, .indexing,
+    ]
+    result.output("Loads:")
+    var total: UInt64 = 0
+    for namespace in context.devices.keys.sorted() {
+      guard let load = context.devices[namespace] else { continue }
+      let durations = load.durations
+      let loadTotal = phases.reduce(0) { $0 + (durations[$1] ?? 0) }
+      total += loadTotal
+      var description = """
+        \(namespace) “\(load.name)”: \
+        \(CommandStatistics.format(nanoseconds: loadTotal))
+        """
+      let phase = load.phase
+      if phase != .finished {
+        description.append(" (\(phase.rawValue))")
+      }
+      result.output("  \(description)")
+      for phase in phases {
+        guard let duration = durations[phase] else { continue }
+        result.output(
+          self.row(
+            phase.rawValue, CommandStatistics.format(nanoseconds: duration),
+            indent: 4))
+      }
+    }
+    result.output(
+      self.row(
+        "total", CommandStatistics.format(nanoseconds: total), indent: 2))
+  }
+}
@@ -0,0 +1,282 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import Foundation
+import MMIOUtilities
+
+struct WatchCommand: SVD2LLDBCommand {
+  static let autoRepeat = ""
+  static let configuration = CommandConfiguration(
+    commandName: "watch",
+    _superCommandName: "svd",
+    abstract: "Sample registers and decode the fields which changed.")
+
+  @Argument(help: "Key-path to a peripheral, cluster, register, or field.")
+  var keyPath: [String] = []
+
+  @Option(help: .init("Time to wait between samples.", valueName: "ms"))
+  var interval: UInt64 = 100
+
+  @Option(help: "Number of samples to take.")
+  var samples: Int = 1
+
+  @Flag(help: "Always read ignoring side-effects.")
+  var force: Bool = false
+
+  @Flag(help: "Print table values in binary instead of hexadecimal.")
+  var binary: Bool = false
+
+  @Flag(help: "Print the recorded samples instead of sampling.")
+  var dump: Bool = false
+
+  mutating func validate() throws {
+    guard self.dump || !self.keyPath.isEmpty else {
+      throw ValidationError("Missing expected argument '<key-path> ...'")
+    }
+    guard self.samples > 0 else {
+      throw ValidationError("Invalid sample count “\(self.samples)”.")
+    }
+  }
+
+  mutating func run(
+    debugger: inout some SVD2LLDBDebugger,
+    result: inout some SVD2LLDBResult,
+    context: SVD2LLDB
+  ) throws -> Bool {
+    // Compare the requested key paths before resolving their namespaces.
+    let requestedKeyPaths = self.keyPath
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &self.keyPath, result: &result)
+
+    if self.dump {
+      guard let watch = context.registerWatch else {
+        throw GenericError("No registers are being watched.")
+      }
+      for sample in watch.samples {
+        self.render(watch: watch, sample: sample, result: &result)
+      }
+      return true
+    }
+
+    // Reuse the previous watch when the same registers are requested again,
+    // for example by a stop hook, to skip resolving the key paths and planning
+    // the reads.
+    let watch: RegisterWatch
+    if let previous = context.registerWatch,
+      previous.keyPaths == requestedKeyPaths,
+      previous.force == self.force
+    {
+      watch = previous
+    } else {
+      watch = try self.watch(
+        index: index, requestedKeyPaths: requestedKeyPaths, result: &result)
+      context.registerWatch = watch
+    }
+
+    for sample in 0..<self.samples {
+      if sample > 0 {
+        Thread.sleep(forTimeInterval: Double(self.interval) / 1000)
+      }
+      let (previous, current) = watch.sample(debugger: &debugger)
+      if let previous {
+        self.render(
+          watch: watch,
+          previous: previous,
+          current: current,
+          result: &result)
+      } else {
+        self.render(watch: watch, sample: current, result: &result)
+      }
+    }
+    return true
+  }
+
+  /// Resolves the requested key paths into the registers to watch.
+  func watch(
+    index: DeviceIndex,
+    requestedKeyPaths: [String],
+    result: inout some SVD2LLDBResult
+  ) throws -> RegisterWatch {
+    // Collect the requested registers along with the fields to display for
+    // each. Requesting a register or container displays all fields.
+    var requestedFields: [Int: Set<Int>] = [:]
+    var allFields: Set<Int> = []
+    for argument in self.keyPath {
+      guard let pattern = KeyPathPattern(argument) else {
+        throw GenericError("Invalid key path “\(argument)”.")
+      }
+      let nodes = index.nodes(matching: pattern)
+      guard !nodes.isEmpty else {
+        throw GenericError("Unknown item “\(argument)”.")
+      }
+      var queue = nodes
+      while let node = queue.popLast() {
+        switch index.nodes[node].kind {
+        case .field:
+          let register = index.nodes[node].parent
+          requestedFields[register, default: []].insert(node)
+        case .register:
+          requestedFields[node, default: []] = []
+          allFields.insert(node)
+        case .device, .peripheral, .cluster:
+          queue.append(contentsOf: index.nodes[node].children)
+        }
+      }
+    }
+
+    // Watch the registers in address order, skipping registers with
+    // side-effects or outside the address blocks of their peripheral unless
+    // forced and preventing coalesced reads from reading through them, unmapped
+    // space, or buffers.
+    var registers: [RegisterWatch.Register] = []
+    var barriers = index.unmappedRanges + index.bufferRanges
+    var skipped = false
+    var unmapped = false
+    var wide = false
+    let order = requestedFields.keys.sorted {
+      (index.nodes[$0].address, $0) < (index.nodes[$1].address, $1)
+    }
+    for register in order {
+      let node = index.nodes[register]
+      let byteCount = node.size.roundUp(toMultipleOf: 8) / 8
+      let range = node.address..<node.address + byteCount
+      let isUnmapped = index.unmappedRanges.mergedRangesOverlap(range)
+      guard !isUnmapped || self.force else {
+        // The unmapped range is already a barrier.
+        unmapped = true
+        continue
+      }
+      guard node.readAction == nil || self.force else {
+        barriers.append(range)
+        skipped = true
+        continue
+      }
+      // Samples hold 64-bit values, use `svd read` for wider registers.
+      guard node.size <= 64 else {
+        wide = true
+        continue
+      }
+      let fields =
+        if allFields.contains(register) {
+          Array(node.children)
+        } else {
+          Array(requestedFields[register, default: []])
+        }
+      registers.append(
+        .init(
+          name: index.keyPath(of: register),
+          address: node.address,
+          bits: node.size,
+          sideEffects: node.readAction != nil,
+          unmapped: isUnmapped,
+          fields: fields.map { field in
+            DecodeCommand.TableField(
+              name: index.nodes[field].name,
+              bitRange: index.nodes[field].bitRange ?? 0..<0,
+              enumeratedValues: index.fields[index.nodes[field].item]
+                .enumeratedValues)
+          }))
+    }
+
+    if skipped {
+      result.warning(
+        """
+        Skipped registers with side-effects. Use “--force” to watch these \
+        registers.
+        """)
+    }
+    if unmapped {
+      result.warning(
+        """
+        Skipped registers outside the address blocks of their peripheral. Use \
+        “--force” to watch these registers.
+        """)
+    }
+    if wide {
+      result.warning(
+        """
+        Skipped registers wider than 64 bits. Use “svd read” to read these \
+        registers.
+        """)
+    }
+    guard !registers.isEmpty else {
+      throw GenericError("No registers to watch.")
+    }
+
+    return RegisterWatch(
+      keyPaths: requestedKeyPaths,
+      force: self.force,
+      registers: registers,
+      barriers: barriers)
+  }
+}
+
+// MARK: - Output rendering
+extension WatchCommand {
+  /// Renders the value of every register in a sample.
+  func render(
+    watch: RegisterWatch,
+    sample: RegisterWatch.Sample,
+    result: inout some SVD2LLDBResult
+  ) {
+    result.output("Sample \(sample.number):")
+    for (register, value) in zip(watch.registers, sample.values) {
+      let value = Self.description(of: value, register: register)
+      result.output("  \(register.name): \(value)")
+    }
+  }
+
+  /// Renders the registers which changed between two samples, decoding only
+  /// the fields which changed.
+  func render(
+    watch: RegisterWatch,
+    previous: RegisterWatch.Sample,
+    current: RegisterWatch.Sample,
+    result: inout some SVD2LLDBResult
+  ) {
+    var header = false
+    for (index, register) in watch.registers.enumerated() {
+      let oldValue = previous.values[index]
+      let newValue = current.values[index]
+      guard oldValue != newValue else { continue }
+
+      if !header {
+        result.output("Sample \(current.number):")
+        header = true
+      }
+      let oldDescription = Self.description(of: oldValue, register: register)
+      let newDescription = Self.description(of: newValue, register: register)
+      result.output(
+        "  \(register.name): \(oldDescription) -> \(newDescription)")
+
+      guard let newValue else { continue }
+      let fields = register.fields.filter { field in
+        guard let oldValue else { return true }
+        return oldValue[bits: field.bitRange] != newValue[bits: field.bitRange]
+      }
+      DecodeCommand.renderTable(
+        fields: fields,
+        value: newValue,
+        binary: self.binary,
+        indent: 4,
+        result: &result)
+    }
+  }
+
+  static func description(
+    of value: UInt64?,
+    register: RegisterWatch.Register
+  ) -> String {
+    guard let value else { return "<error>" }
+    return "\(hex: value, bits: register.bits)"
+  }
+}
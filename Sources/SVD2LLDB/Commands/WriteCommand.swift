@@ -18,119 +18,346 @@ struct WriteCommand: SVD2LLDBCommand {
   static let configuration = CommandConfiguration(
     commandName: "write",
     _superCommandName: "svd",
-    abstract: "Write a new value to a register.")
+    abstract: "Write new values to registers and fields.")
 
-  @Argument(help: "Key-path to a register or field.")
-  var keyPath: String
-
-  @Argument(help: "Value to write.")
-  var value: String
+  @Argument(help: "Register or field assignment, as <key-path>=<value>.")
+  var assignment: [String]
 
   @Flag(help: "Always write or modify ignoring side-effects.")
   var force: Bool = false
 
+  @Flag(help: "Print planned transactions without performing them.")
+  var dryRun: Bool = false
+
   mutating func run(
     debugger: inout some SVD2LLDBDebugger,
     result: inout some SVD2LLDBResult,
     context: SVD2LLDB
   ) throws -> Bool {
-    let device = try context.device.unwrap(or: NoSVDLoadedError())
-    guard self.force else {
+    let assignments = try self.assignments()
+    var keyPaths = assignments.map(\.0)
+    let index = try context.loadedDeviceIndex(
+      keyPaths: &keyPaths, unique: true, result: &result)
+
+    // Combine the assignments to each register into a single write, then
+    // perform the writes in address order.
+    let resolution = context.statistics.begin(.resolution)
+    var writes: [Int: RegisterWrite] = [:]
+    for (keyPath, (_, value)) in zip(keyPaths, assignments) {
+      let node = try self.lookup(keyPath: keyPath, index: index)
+      let register =
+        index.nodes[node].kind == .field ? index.nodes[node].parent : node
+      if writes[register] == nil {
+        writes[register] = try RegisterWrite(index: index, register: register)
+      }
+      try writes[register]?.assign(
+        value: value,
+        bitRange: index.nodes[node].bitRange)
+    }
+    let order = writes.values.sorted {
+      ($0.address, $0.node) < ($1.address, $1.node)
+    }
+    context.statistics.end(resolution)
+
+    // Registers which are only partially assigned must be read first. Refuse
+    // to read registers with side-effects or outside the address blocks of
+    // their peripheral unless forced.
+    let partialWrites = order.filter { !$0.complete }
+    if !self.force, let write = partialWrites.first(where: \.sideEffects) {
+      throw GenericError(
+        """
+        Skipped write of register with side-effects “\(write.name)”. Use \
+        “--force” to read and modify this register.
+        """)
+    }
+    if !self.force, let write = partialWrites.first(where: \.unmapped) {
       throw GenericError(
         """
-        Use “--force“ to write values. Tracking side effects is not \
-        implemented yet.
+        Skipped write of register outside the address blocks of its \
+        peripheral “\(write.name)”. Use “--force” to read and modify this \
+        register.
         """)
     }
-    let info = try self.lookupRegister(item: device)
-    let value = try self.value(info: info)
-    try debugger.write(address: info.address, value: value, bits: info.size)
-    result.output("Wrote: \(hex: value, bits: info.size)")
+
+    if self.dryRun {
+      return self.render(plan: order, result: &result)
+    }
+
+    // Read every partially assigned register before writing any, so a failed
+    // read leaves the device untouched. Never read through unmapped space or
+    // buffers to coalesce reads.
+    let planning = context.statistics.begin(.planning)
+    let plan = ReadPlan(
+      reads: partialWrites.map {
+        .init(
+          address: $0.address,
+          bits: $0.bits,
+          coalescable: !$0.sideEffects && !$0.unmapped)
+      },
+      barriers: index.unmappedRanges + index.bufferRanges,
+      options: .default)
+    var currentValues: [Int: UInt64] = [:]
+    let values = plan.execute(debugger: &debugger)
+    for (write, value) in zip(partialWrites, values) {
+      guard let value else {
+        throw GenericError(
+          "Failed to read register “\(write.name)”, no values were written.")
+      }
+      currentValues[write.node] = value
+    }
+    context.statistics.end(planning)
+
+    // Writes may have side-effects on any register, discard all cached values.
+    defer { context.registerValueCache.invalidate() }
+    var written: [(name: String, value: UInt64, bits: UInt64)] = []
+    for write in order {
+      let value = write.value(current: currentValues[write.node] ?? 0)
+      do {
+        try debugger.write(
+          address: write.address,
+          value: value,
+          bits: write.bits)
+      } catch {
+        // Report the registers written before the failure, registers after
+        // it in address order are left untouched.
+        if !written.isEmpty {
+          self.render(written: written, result: &result)
+        }
+        throw GenericError(
+          "Failed to write register “\(write.name)”: \(error)")
+      }
+      written.append((write.name, value, write.bits))
+    }
+
+    let rendering = context.statistics.begin(.rendering)
+    defer { context.statistics.end(rendering) }
+    if written.count == 1, let write = written.first {
+      result.output("Wrote: \(hex: write.value, bits: write.bits)")
+    } else {
+      self.render(written: written, result: &result)
+    }
     return true
   }
 
-  struct RegisterInfo {
-    var register: SVDRegister
-    var name: String
-    var readAction: SVDReadAction?
-    var writeAction: SVDModifiedWriteValues?
-    var address: UInt64
-    var size: UInt64
+  /// Renders the name and written value of each register to the user.
+  func render(
+    written: [(name: String, value: UInt64, bits: UInt64)],
+    result: inout some SVD2LLDBResult
+  ) {
+    result.output("Wrote:")
+    for write in written {
+      result.output("  \(write.name): \(hex: write.value, bits: write.bits)")
+    }
   }
 
-  func lookupRegister(item: any SVDItem) throws -> RegisterInfo {
-    // Split the first argument by "."s into a key path and normalize by
-    // lowercasing keys.
-    var keyPath = self.keyPath.split(separator: ".").map { $0.lowercased() }
-    guard !keyPath.isEmpty else {
-      throw ValidationError("Invalid key path “\(self.keyPath)”.")
-    }
-
-    // Find the user requested item in device. While searching, normalize the
-    // key path name and determine metadata about the register.
-    var item = item
-    var name = ""
-    var readAction = item.readAction
-    var modifiedWriteValues = item.modifiedWriteValues
-    var address = item.addressOffset
-    var size = item.registerProperties.size ?? 0
-    // Flip the keyPath so we pop from the back O(1) instead of the front O(N).
-    keyPath.reverse()
-    while let key = keyPath.last {
-      defer { keyPath.removeLast() }
-      guard let childItem = item.child(at: key) else {
-        throw GenericError("Unknown item “\(self.keyPath)”.")
+  /// Renders the memory transactions which would be performed to the user.
+  func render(
+    plan: [RegisterWrite],
+    result: inout some SVD2LLDBResult
+  ) -> Bool {
+    result.output("Would write:")
+    for write in plan {
+      let address = "m[\(hex: write.address)]"
+      let constant = "\(hex: write.constant, bits: write.bits)"
+      if write.complete {
+        result.output("  \(write.name): \(address) <- \(constant)")
+      } else {
+        let preserved = "\(hex: write.preserved, bits: write.bits)"
+        result.output(
+          """
+            \(write.name): \(address) <- (\(address) & \(preserved)) | \
+          \(constant)
+          """)
       }
+    }
+    return true
+  }
 
-      if !name.isEmpty {
-        name.append(".")
+  /// Splits the arguments into key path and value pairs.
+  ///
+  /// Arguments of the form “key-path=value” are assignments, any other
+  /// argument is a key path followed by its value.
+  func assignments() throws -> [(String, String)] {
+    var assignments: [(String, String)] = []
+    var arguments = self.assignment[...]
+    while let argument = arguments.popFirst() {
+      if let equals = argument.firstIndex(of: "=") {
+        assignments.append(
+          (
+            String(argument[..<equals]),
+            String(argument[argument.index(after: equals)...])
+          ))
+      } else if let value = arguments.popFirst() {
+        assignments.append((argument, value))
+      } else {
+        throw ValidationError("Missing value for key path “\(argument)”.")
       }
-      name.append(childItem.name)
-      item = childItem
-      readAction = childItem.readAction ?? readAction
-      modifiedWriteValues = childItem.modifiedWriteValues ?? modifiedWriteValues
-      address = childItem.addressOffset + address
-      size = childItem.registerProperties.size ?? size
     }
+    return assignments
+  }
 
-    // Error if the item was found but isn't a register.
-    guard let register = item as? SVDRegister else {
-      throw GenericError("Invalid register key path “\(name)”.")
+  /// Returns the index node of the register or field at a key path.
+  func lookup(keyPath: String, index: DeviceIndex) throws -> Int {
+    // Split the key path by "."s.
+    let components = keyPath.split(separator: ".")
+    guard !components.isEmpty else {
+      throw ValidationError("Invalid key path “\(keyPath)”.")
     }
 
+    // Find the user requested item in the device index, which holds the
+    // normalized name and metadata about the register.
+    guard let node = index.node(at: components) else {
+      throw GenericError("Unknown item “\(keyPath)”.")
+    }
+
+    // Error if the item was found but isn't a register or field.
+    switch index.nodes[node].kind {
+    case .register, .field:
+      return node
+    case .device, .peripheral, .cluster:
+      throw GenericError(
+        "Invalid register key path “\(index.keyPath(of: node))”.")
+    }
+  }
+}
+
+extension WriteCommand {
+  /// A write to a register combining every assignment to the register and its
+  /// fields.
+  struct RegisterWrite {
+    var node: Int
+    var name: String
+    var address: UInt64
+    var bits: UInt64
+    /// Whether reading the register has side-effects.
+    var sideEffects: Bool
+    /// Whether the register is outside the address blocks of its peripheral.
+    var unmapped: Bool
+
+    /// The bits assigned a value.
+    var mask: UInt64 = 0
+    /// The value of the assigned bits.
+    var assigned: UInt64 = 0
+    /// The unassigned bits which retain their current value when written.
+    var keep: UInt64
+    /// The unassigned bits which are written as one.
+    var set: UInt64 = 0
+  }
+}
+
+extension WriteCommand.RegisterWrite {
+  init(index: DeviceIndex, register: Int) throws {
+    let node = index.nodes[register]
+    self.node = register
+    self.name = index.keyPath(of: register)
+    self.address = node.address
+    self.bits = node.size
+
     // Error if the register is too large to handle.
-    let sizeSingular = size == 1
-    guard size <= 64 else {
+    let sizeSingular = self.bits == 1
+    guard 0 < self.bits, self.bits <= 64 else {
       throw GenericError(
-        "Invalid register size “\(size)“ bit\(sizeSingular ? "" : "s").")
+        "Invalid register size “\(self.bits)“ bit\(sizeSingular ? "" : "s").")
+    }
+    var registerBits: UInt64 = 0
+    registerBits[bits: 0..<self.bits] = .max
+    self.keep = registerBits
+
+    let byteCount = self.bits.roundUp(toMultipleOf: 8) / 8
+    self.unmapped = index.unmappedRanges.mergedRangesOverlap(
+      self.address..<self.address + byteCount)
+
+    // Unassigned bits are written back with a value which does not trigger
+    // their write side-effects: zero for bits where writing one has an effect,
+    // one for bits where writing zero does. Bits outside of any field take
+    // the side-effects of the register.
+    self.sideEffects = node.readAction != nil
+    var fieldBits: UInt64 = 0
+    for field in node.children {
+      let field = index.nodes[field]
+      self.sideEffects = self.sideEffects || field.readAction != nil
+      guard let range = field.bitRange, range.upperBound <= self.bits else {
+        continue
+      }
+      var bits: UInt64 = 0
+      bits[bits: range] = .max
+      fieldBits |= bits
+      self.neutralize(
+        bits: bits,
+        modifiedWriteValues: field.modifiedWriteValues)
     }
+    self.neutralize(
+      bits: registerBits & ~fieldBits,
+      modifiedWriteValues: node.modifiedWriteValues)
+  }
 
-    return RegisterInfo(
-      register: register,
-      name: name,
-      readAction: readAction,
-      address: address,
-      size: size)
+  mutating func neutralize(
+    bits: UInt64,
+    modifiedWriteValues: SVDModifiedWriteValues?
+  ) {
+    switch modifiedWriteValues {
+    case .oneToClear, .oneToSet, .oneToToggle:
+      self.keep &= ~bits
+    case .zeroToClear, .zeroToSet, .zeroToToggle:
+      self.keep &= ~bits
+      self.set |= bits
+    case .clear, .set, .modify, nil:
+      break
+    }
   }
 
-  func value(
-    info: RegisterInfo
-  ) throws -> UInt64 {
+  /// Assigns a value to the whole register, or to a field if `bitRange` is
+  /// provided. Later assignments replace the overlapping bits of earlier
+  /// assignments.
+  mutating func assign(
+    value userValue: String,
+    bitRange: Range<UInt64>?
+  ) throws {
     // Parse the value into a UInt64.
-    let userValue = self.value
     var valueRaw = userValue.utf8[...]
     guard let value = SwiftIntegerParser<UInt64>().parse(&valueRaw) else {
       throw ValidationError("Invalid value “\(userValue)”.")
     }
-    // Error if the user provided value exceeds the size of the register.
-    let sizeSingular = info.size == 1
-    guard (value >> info.size) == 0 else {
+
+    let range = bitRange ?? 0..<self.bits
+    guard range.upperBound <= self.bits else {
+      throw GenericError("Invalid field bit range of register “\(self.name)”.")
+    }
+
+    // Error if the user provided value exceeds the size of the register or
+    // field.
+    let size = UInt64(range.count)
+    let sizeSingular = size == 1
+    guard (value >> size) == 0 else {
       throw GenericError(
         """
-        Invalid value “\(userValue)“ larger than register size \
-        “\(info.size)“ bit\(sizeSingular ? "" : "s").
+        Invalid value “\(userValue)“ larger than \
+        \(bitRange == nil ? "register" : "field") size \
+        “\(size)“ bit\(sizeSingular ? "" : "s").
         """)
     }
-    return value
+    self.assigned[bits: range] = value
+    self.mask[bits: range] = .max
+  }
+
+  /// Whether the value to write does not depend on the current value of the
+  /// register, so the register does not need to be read before it is written.
+  var complete: Bool {
+    self.keep & ~self.mask == 0
+  }
+
+  /// The bits of the register which keep their current value.
+  var preserved: UInt64 {
+    self.keep & ~self.mask
+  }
+
+  /// The bits written regardless of the current value of the register.
+  var constant: UInt64 {
+    (self.set & ~self.mask) | self.assigned
+  }
+
+  /// The value to write given the current value of the register.
+  func value(current: UInt64) -> UInt64 {
+    (current & self.preserved) | self.constant
   }
 }
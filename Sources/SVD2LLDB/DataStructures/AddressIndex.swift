@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// The registers of every loaded device sorted by address.
+///
+/// Multi-core parts often describe each subsystem in a separate SVD file.
+/// `AddressIndex` merges the registers of all loaded devices so a raw address
+/// can be dispatched to the devices and registers mapping it with a binary
+/// search instead of a scan of each device.
+struct AddressIndex {
+  struct Entry: Equatable {
+    /// The bytes occupied by the register.
+    var range: Range<UInt64>
+    /// The namespace of the device containing the register.
+    var namespace: String
+    /// The register node in the index of the device.
+    var node: Int
+  }
+
+  /// The registers sorted by their lowest address.
+  var entries: [Entry]
+  /// The highest upper bound of the entries up to and including each entry.
+  ///
+  /// Registers may overlap, for example alternate registers, so lookups scan
+  /// backwards from the last register starting at or before an address until
+  /// no earlier register can contain it.
+  var upperBounds: [UInt64]
+}
+
+extension AddressIndex {
+  init(devices: [(namespace: String, index: DeviceIndex)]) {
+    self.entries = []
+    for (namespace, index) in devices {
+      for (node, item) in index.nodes.enumerated()
+      where item.kind == .register {
+        let byteCount = item.size.roundUp(toMultipleOf: 8) / 8
+        let (upperBound, overflow) =
+          item.address.addingReportingOverflow(byteCount)
+        self.entries.append(
+          .init(
+            range: item.address..<(overflow ? .max : upperBound),
+            namespace: namespace,
+            node: node))
+      }
+    }
+    self.entries.sort {
+      ($0.range.lowerBound, $0.namespace, $0.node)
+        < ($1.range.lowerBound, $1.namespace, $1.node)
+    }
+
+    self.upperBounds = []
+    self.upperBounds.reserveCapacity(self.entries.count)
+    var upperBound: UInt64 = 0
+    for entry in self.entries {
+      upperBound = max(upperBound, entry.range.upperBound)
+      self.upperBounds.append(upperBound)
+    }
+  }
+
+  /// Returns the registers containing `address` in address order.
+  func entries(containing address: UInt64) -> [Entry] {
+    // Find the first register starting after the address.
+    var low = 0
+    var high = self.entries.count
+    while low < high {
+      let middle = (low + high) / 2
+      if self.entries[middle].range.lowerBound <= address {
+        low = middle + 1
+      } else {
+        high = middle
+      }
+    }
+
+    var matches: [Entry] = []
+    var index = low
+    while index > 0, self.upperBounds[index - 1] > address {
+      index -= 1
+      if self.entries[index].range.contains(address) {
+        matches.append(self.entries[index])
+      }
+    }
+    return matches.reversed()
+  }
+}
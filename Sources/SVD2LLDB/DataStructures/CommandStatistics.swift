@@ -0,0 +1,186 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Dispatch
+
+/// Timings of the commands run in the current session, reported by `svd
+/// stats`.
+///
+/// Commands attribute the time they spend to phases by measuring spans of
+/// work. Spans may nest, in which case time spent in the inner span is only
+/// attributed to the inner phase, so the durations of all phases never exceed
+/// the total time of the command. Memory transactions are measured by an
+/// ``InstrumentedDebugger`` wrapping the debugger of each command.
+final class CommandStatistics {
+  enum Phase: String, CaseIterable {
+    /// Waiting for a background load started by `svd load`.
+    case loading
+    /// Resolving namespaces, addresses, and key paths into device items.
+    case resolution
+    /// Planning reads and writes, and consulting the register value cache.
+    case planning
+    /// Performing memory transactions.
+    case memory
+    /// Formatting the output of the command.
+    case rendering
+  }
+
+  struct Record {
+    /// The command and its arguments as entered by the user.
+    var command: String
+    /// The time spent in each phase in nanoseconds.
+    var durations: [Phase: UInt64] = [:]
+    /// The time spent running the command in nanoseconds.
+    var total: UInt64 = 0
+    /// The number of memory transactions performed.
+    var transactions = 0
+    /// The number of bytes read or written by memory transactions.
+    var bytes = 0
+  }
+
+  /// A phase of work being measured.
+  struct Span {
+    var phase: Phase
+    var start: UInt64
+    var nested: UInt64
+  }
+
+  /// The number of commands retained.
+  static let capacity = 16
+
+  /// Returns the current time in nanoseconds.
+  var clock: () -> UInt64
+  /// Receives a line for each command and memory transaction while tracing.
+  var trace: ((String) -> Void)?
+  /// The most recently completed commands, oldest first.
+  private(set) var records: RingBuffer<Record>
+  /// The command currently running, if any.
+  private var current: Record?
+  private var start: UInt64
+  /// The total time of all spans ended so far, used to exclude the time of
+  /// nested spans from their parent.
+  private var nested: UInt64
+
+  init(
+    clock: @escaping () -> UInt64 = { DispatchTime.now().uptimeNanoseconds }
+  ) {
+    self.clock = clock
+    self.trace = nil
+    self.records = RingBuffer(capacity: Self.capacity)
+    self.current = nil
+    self.start = 0
+    self.nested = 0
+  }
+}
+
+extension CommandStatistics {
+  /// Starts recording a command.
+  func beginCommand(_ command: String) {
+    self.current = Record(command: command)
+    self.start = self.clock()
+    self.trace?(command)
+  }
+
+  /// Finishes recording the current command.
+  func endCommand() {
+    guard var record = self.current else { return }
+    record.total = self.clock() - self.start
+    self.records.append(record)
+    self.current = nil
+    self.trace?("  \(Self.summary(of: record))")
+  }
+
+  /// Discards the recorded commands.
+  func reset() {
+    self.records = RingBuffer(capacity: Self.capacity)
+  }
+
+  /// Starts measuring a span of `phase`.
+  func begin(_ phase: Phase) -> Span {
+    Span(phase: phase, start: self.clock(), nested: self.nested)
+  }
+
+  /// Finishes measuring `span`, attributing its time not spent in nested
+  /// spans to its phase, and returns the time elapsed since it began.
+  @discardableResult
+  func end(_ span: Span) -> UInt64 {
+    let elapsed = self.clock() - span.start
+    let nested = self.nested - span.nested
+    self.current?.durations[span.phase, default: 0] += elapsed - nested
+    self.nested = span.nested + elapsed
+    return elapsed
+  }
+
+  /// Measures the time spent in `body` as a span of `phase`.
+  func measure<T>(_ phase: Phase, _ body: () throws -> T) rethrows -> T {
+    let span = self.begin(phase)
+    defer { self.end(span) }
+    return try body()
+  }
+
+  /// Records a memory transaction of the current command.
+  func recordTransaction(_ description: String, bytes: Int, time: UInt64) {
+    self.current?.transactions += 1
+    self.current?.bytes += bytes
+    self.trace?("  \(description): \(Self.format(nanoseconds: time))")
+  }
+
+  /// Records a batch of memory transactions of the current command which
+  /// were performed together in `time` nanoseconds.
+  func recordTransactions(
+    _ transactions: [(description: String, bytes: Int)],
+    time: UInt64
+  ) {
+    guard transactions.count > 1 else {
+      for transaction in transactions {
+        self.recordTransaction(
+          transaction.description, bytes: transaction.bytes, time: time)
+      }
+      return
+    }
+    for transaction in transactions {
+      self.current?.transactions += 1
+      self.current?.bytes += transaction.bytes
+      self.trace?("  \(transaction.description)")
+    }
+    let count = transactions.count
+    self.trace?(
+      "  batch of \(count) transactions: \(Self.format(nanoseconds: time))")
+  }
+}
+
+extension CommandStatistics {
+  /// Formats a duration in nanoseconds as milliseconds, as in "1.234 ms".
+  static func format(nanoseconds: UInt64) -> String {
+    let microseconds = nanoseconds / 1_000
+    let fraction = "\(microseconds % 1_000)"
+    var description = "\(microseconds / 1_000)."
+    description.append(repeating: "0", count: 3 - fraction.count)
+    description.append(fraction)
+    description.append(" ms")
+    return description
+  }
+
+  /// Returns a single line summary of the phases of a command.
+  static func summary(of record: Record) -> String {
+    var phases: [String] = []
+    for phase in Phase.allCases {
+      guard let duration = record.durations[phase] else { continue }
+      phases.append("\(phase.rawValue) \(Self.format(nanoseconds: duration))")
+    }
+    return """
+      total \(Self.format(nanoseconds: record.total)) \
+      (\(phases.joined(separator: ", "))), \(record.transactions) \
+      transaction\(record.transactions == 1 ? "" : "s"), \(record.bytes) \
+      byte\(record.bytes == 1 ? "" : "s")
+      """
+  }
+}
@@ -0,0 +1,198 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import SVD
+
+/// A compressed, case-insensitive radix trie of every key path in a device.
+///
+/// The index is built once when a device is loaded and is used to complete
+/// partially typed key paths. Edge labels are stored as ranges into a single
+/// buffer of case-folded UTF-8 bytes and children are sorted by the first byte
+/// of their label, so lookups only touch the nodes along the typed prefix and
+/// the candidates beneath it.
+struct CompletionIndex {
+  struct Node {
+    /// The range of the node's edge label in `bytes`.
+    var label: Range<Int>
+    /// Indices of the child nodes sorted by the first byte of their label.
+    var children: [Int]
+    /// Index of the key path terminating at this node in `paths`.
+    var path: Int?
+  }
+
+  var bytes: [UInt8]
+  var nodes: [Node]
+  /// Key paths using the capitalization found in the device.
+  var paths: [String]
+
+  init() {
+    self.bytes = []
+    self.nodes = [Node(label: 0..<0, children: [], path: nil)]
+    self.paths = []
+  }
+}
+
+extension CompletionIndex {
+  init(paths: some Sequence<String>) {
+    self.init()
+    for path in paths {
+      self.insert(path)
+    }
+  }
+
+  /// Creates an index containing the key path of every peripheral, cluster,
+  /// register, and field in `device`, including dimension array elements.
+  init(device: SVDDevice) {
+    self.init(index: DeviceIndex(device: device))
+  }
+
+  init(index: DeviceIndex) {
+    self.init()
+    var paths = [String](repeating: "", count: index.nodes.count)
+    // Nodes are in breadth-first order so parents precede their children.
+    for node in index.nodes.indices where node != DeviceIndex.root {
+      let parent = index.nodes[node].parent
+      let name = index.nodes[node].name
+      paths[node] =
+        parent == DeviceIndex.root ? name : "\(paths[parent]).\(name)"
+      self.insert(paths[node])
+    }
+  }
+
+  mutating func insert(_ path: String) {
+    let key = Array(path.lowercased().utf8)
+    var node = 0
+    var index = 0
+    while index < key.count {
+      guard
+        let (position, child) = self.child(of: node, startingWith: key[index])
+      else {
+        // No child shares a prefix with the rest of the key, add a new leaf.
+        let start = self.bytes.count
+        self.bytes.append(contentsOf: key[index...])
+        let leaf = self.nodes.count
+        self.nodes.append(
+          Node(label: start..<self.bytes.count, children: [], path: nil))
+        let insertion = self.nodes[node].children.firstIndex {
+          self.bytes[self.nodes[$0].label.lowerBound] > key[index]
+        }
+        self.nodes[node].children.insert(
+          leaf, at: insertion ?? self.nodes[node].children.count)
+        node = leaf
+        index = key.count
+        break
+      }
+
+      // Find the length of the prefix shared by the child's label and the
+      // rest of the key.
+      let label = self.nodes[child].label
+      var length = 0
+      while length < label.count, index + length < key.count,
+        self.bytes[label.lowerBound + length] == key[index + length]
+      {
+        length += 1
+      }
+
+      if length < label.count {
+        // Split the child's edge at the end of the shared prefix.
+        let split = self.nodes.count
+        self.nodes.append(
+          Node(
+            label: label.lowerBound..<label.lowerBound + length,
+            children: [child],
+            path: nil))
+        self.nodes[child].label = label.lowerBound + length..<label.upperBound
+        self.nodes[node].children[position] = split
+        node = split
+      } else {
+        node = child
+      }
+      index += length
+    }
+
+    // Keep the first capitalization of duplicate key paths.
+    if self.nodes[node].path == nil {
+      self.nodes[node].path = self.paths.count
+      self.paths.append(path)
+    }
+  }
+
+  private func child(
+    of node: Int,
+    startingWith byte: UInt8
+  ) -> (position: Int, child: Int)? {
+    let children = self.nodes[node].children
+    // Binary search the children sorted by the first byte of their label.
+    var lowerBound = 0
+    var upperBound = children.count
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      let first = self.bytes[self.nodes[children[middle]].label.lowerBound]
+      if first < byte {
+        lowerBound = middle + 1
+      } else if first > byte {
+        upperBound = middle
+      } else {
+        return (middle, children[middle])
+      }
+    }
+    return nil
+  }
+}
+
+extension CompletionIndex {
+  /// Returns the key paths which complete `prefix` up to the end of its last
+  /// key, ignoring case.
+  ///
+  /// For example the prefix "rcc.apb" completes to "RCC.APB1ENR" and
+  /// "RCC.APB2ENR", but not to the fields of these registers.
+  func completions(of prefix: String, limit: Int = .max) -> [String] {
+    let key = Array(prefix.lowercased().utf8)
+
+    // Walk down the trie consuming the prefix.
+    var node = 0
+    var index = 0
+    // The number of bytes of the current node's label consumed by the prefix.
+    var consumed = 0
+    while index < key.count {
+      guard let (_, child) = self.child(of: node, startingWith: key[index])
+      else { return [] }
+      let label = self.nodes[child].label
+      var length = 0
+      while length < label.count, index + length < key.count {
+        guard self.bytes[label.lowerBound + length] == key[index + length]
+        else { return [] }
+        length += 1
+      }
+      node = child
+      index += length
+      consumed = length
+    }
+
+    // Collect the key paths beneath the node which do not contain another
+    // key separator beyond the prefix.
+    var completions: [String] = []
+    var queue: [(node: Int, consumed: Int)] = [(node, consumed)]
+    while let (node, consumed) = queue.popLast(), completions.count < limit {
+      let label = self.nodes[node].label
+      let remainder = self.bytes[label.lowerBound + consumed..<label.upperBound]
+      // Nodes after a separator belong to deeper keys.
+      if remainder.contains(UInt8(ascii: ".")) { continue }
+      if let path = self.nodes[node].path {
+        completions.append(self.paths[path])
+      }
+      for child in self.nodes[node].children.reversed() {
+        queue.append((child, 0))
+      }
+    }
+    return completions
+  }
+}
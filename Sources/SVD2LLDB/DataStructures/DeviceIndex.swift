@@ -0,0 +1,469 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import MMIOUtilities
+import SVD
+
+/// A flattened, read-only index of the items in a device.
+///
+/// Nodes are laid out in breadth-first order so the children of each node
+/// occupy a contiguous range of `nodes`. Dimension arrays are expanded into one
+/// node per element and each node stores its absolute address, effective size,
+/// and effective read action, so key paths can be resolved and the device
+/// traversed without walking or copying the SVD model.
+///
+/// The SVD items themselves are stored in one array per kind and referenced by
+/// position from their nodes, for commands which need details such as a
+/// register's fields.
+///
+/// The children of each node are also sorted by name once, so key paths and
+/// patterns are resolved by binary search rather than by comparing every
+/// child's name.
+///
+/// The address blocks of the peripherals are flattened into the ranges of
+/// addresses which must never be read, so reads can be planned without
+/// touching holes in the memory map which may fault the bus.
+struct DeviceIndex {
+  enum Kind {
+    case device
+    case peripheral
+    case cluster
+    case register
+    case field
+  }
+
+  struct Node {
+    var kind: Kind
+    /// The position of the node's item in the storage for its kind.
+    var item: Int
+    var name: String
+    /// The lowercased name used for case-insensitive matching.
+    var foldedName: String
+    var parent: Int
+    var children: Range<Int>
+    /// The absolute address of the node, or of the parent register for
+    /// fields.
+    var address: UInt64
+    /// The size in bits of the node's register.
+    var size: UInt64
+    /// The register properties of the node merged with those of its
+    /// ancestors.
+    var registerProperties: SVDRegisterProperties
+    var readAction: SVDReadAction?
+    var modifiedWriteValues: SVDModifiedWriteValues?
+    /// The range of bits occupied by a field within its register.
+    var bitRange: Range<UInt64>?
+  }
+
+  var device: SVDDevice
+  var peripherals: [SVDPeripheral] = []
+  var clusters: [SVDCluster] = []
+  var registers: [SVDRegister] = []
+  var fields: [SVDField] = []
+  var nodes: [Node]
+  /// The children of every node ordered by folded name, then by position.
+  ///
+  /// The sorted children of a node occupy the same range as its `children`,
+  /// so the table is a permutation of the node positions.
+  var sortedChildren: [Int] = []
+  /// Addresses outside the address blocks of every peripheral or within
+  /// reserved blocks, merged in ascending order.
+  ///
+  /// Empty if the device does not declare any address blocks.
+  var unmappedRanges: [Range<UInt64>] = []
+  /// Addresses within buffer blocks, merged in ascending order. Registers may
+  /// be declared in a buffer, but buffers are never read to coalesce reads of
+  /// other registers.
+  var bufferRanges: [Range<UInt64>] = []
+}
+
+extension DeviceIndex {
+  static let root = 0
+
+  init(device: SVDDevice) {
+    self.device = device
+    self.nodes = [
+      Node(
+        kind: .device,
+        item: 0,
+        name: device.name,
+        foldedName: device.name.lowercased(),
+        parent: Self.root,
+        children: 0..<0,
+        address: device.addressOffset,
+        size: device.registerProperties.size ?? 0,
+        registerProperties: device.registerProperties,
+        readAction: nil,
+        modifiedWriteValues: nil,
+        bitRange: nil)
+    ]
+
+    // Visit nodes in breadth-first order, appending the children of each node
+    // to the end of the node list.
+    var index = 0
+    while index < self.nodes.count {
+      let node = self.nodes[index]
+      let start = self.nodes.count
+      switch node.kind {
+      case .device:
+        self.append(children: device.peripherals.peripheral, of: index)
+      case .peripheral:
+        let registers = self.peripherals[node.item].registers
+        self.append(children: registers?.cluster ?? [], of: index)
+        self.append(children: registers?.register ?? [], of: index)
+      case .cluster:
+        let cluster = self.clusters[node.item]
+        self.append(children: cluster.cluster ?? [], of: index)
+        self.append(children: cluster.register ?? [], of: index)
+      case .register:
+        let fields = self.registers[node.item].fields?.field ?? []
+        self.append(children: fields, of: index)
+      case .field:
+        break
+      }
+      self.nodes[index].children = start..<self.nodes.count
+      index += 1
+    }
+
+    self.sortChildren()
+    self.mapAddressBlocks()
+  }
+
+  /// Builds the table of children sorted by folded name.
+  private mutating func sortChildren() {
+    let nodes = self.nodes
+    var sortedChildren = Array(nodes.indices)
+    for node in nodes where node.children.count > 1 {
+      sortedChildren[node.children].sort { lhs, rhs in
+        let lhsName = nodes[lhs].foldedName.utf8
+        let rhsName = nodes[rhs].foldedName.utf8
+        if lhsName.elementsEqual(rhsName) { return lhs < rhs }
+        return lhsName.lexicographicallyPrecedes(rhsName)
+      }
+    }
+    self.sortedChildren = sortedChildren
+  }
+
+  /// Computes the unmapped and buffer ranges of the device from the address
+  /// blocks of its peripherals.
+  private mutating func mapAddressBlocks() {
+    let addressUnitBytes = max(self.device.addressUnitBits / 8, 1)
+    var mapped: [Range<UInt64>] = []
+    var reserved: [Range<UInt64>] = []
+    var buffers: [Range<UInt64>] = []
+    // Peripherals without an address block keep the span of their registers
+    // mapped.
+    var extents: [Int: Range<UInt64>] = [:]
+    // The peripheral of each node, parents always precede their children.
+    var peripheralNodes = [Int](repeating: Self.root, count: self.nodes.count)
+    for (index, node) in self.nodes.enumerated() {
+      switch node.kind {
+      case .device:
+        continue
+      case .peripheral:
+        peripheralNodes[index] = index
+        for block in self.peripherals[node.item].addressBlock ?? [] {
+          guard
+            case (let count, false) = block.size
+              .multipliedReportingOverflow(by: addressUnitBytes),
+            case (let start, false) = node.address
+              .addingReportingOverflow(block.offset),
+            case (let end, false) = start.addingReportingOverflow(count)
+          else { continue }
+          switch block.usage {
+          case .registers:
+            mapped.append(start..<end)
+          case .buffer:
+            mapped.append(start..<end)
+            buffers.append(start..<end)
+          case .reserved:
+            reserved.append(start..<end)
+          }
+        }
+      case .cluster, .register, .field:
+        let peripheral = peripheralNodes[node.parent]
+        peripheralNodes[index] = peripheral
+        guard node.kind == .register else { continue }
+        let blocks = self.peripherals[self.nodes[peripheral].item].addressBlock
+        guard blocks?.isEmpty ?? true else { continue }
+        let end = node.address + node.size.roundUp(toMultipleOf: 8) / 8
+        let extent = extents[peripheral] ?? node.address..<end
+        let lowerBound = min(extent.lowerBound, node.address)
+        let upperBound = max(extent.upperBound, end)
+        extents[peripheral] = lowerBound..<upperBound
+      }
+    }
+
+    // Without address blocks nothing is known about the memory map, keep
+    // reading gaps as requested.
+    guard !mapped.isEmpty || !reserved.isEmpty else { return }
+
+    // Every address outside the mapped ranges is unmapped, as are reserved
+    // blocks even if another peripheral claims to map them.
+    mapped = (mapped + extents.values).merged()
+    var unmapped = reserved
+    var lowerBound: UInt64 = 0
+    for range in mapped {
+      unmapped.append(lowerBound..<range.lowerBound)
+      lowerBound = range.upperBound
+    }
+    unmapped.append(lowerBound..<UInt64.max)
+    self.unmappedRanges = unmapped.merged()
+    self.bufferRanges = buffers.merged()
+  }
+
+  /// Appends the nodes for `items`, one per element of dimension arrays, as
+  /// children of `parent` and stores the items for later lookup.
+  ///
+  /// Generic over the item type so children are never boxed into
+  /// existentials.
+  private mutating func append<Item>(
+    children items: [Item],
+    of parent: Int
+  ) where Item: DeviceIndexItem {
+    let parentNode = self.nodes[parent]
+    let kind = Item.kind
+    for item in items {
+      let position = self[keyPath: Item.storage].count
+      self[keyPath: Item.storage].append(item)
+      let bitRange = item.indexBitRange
+
+      let registerProperties = item.registerProperties
+        .merging(parentNode.registerProperties)
+      let names = Self.elementNames(
+        name: item.name,
+        dimensionElement: item.dimensionElement)
+      for (element, name) in names.enumerated() {
+        let increment =
+          UInt64(element) * (item.dimensionElement?.dimIncrement ?? 0)
+        // Fields share the address of their register and repeat within it
+        // instead.
+        let address =
+          kind == .field
+          ? parentNode.address
+          : parentNode.address + item.addressOffset + increment
+        self.nodes.append(
+          Node(
+            kind: kind,
+            item: position,
+            name: name,
+            foldedName: name.lowercased(),
+            parent: parent,
+            children: 0..<0,
+            address: address,
+            size: registerProperties.size ?? 0,
+            registerProperties: registerProperties,
+            readAction: item.readAction ?? parentNode.readAction,
+            modifiedWriteValues: item.modifiedWriteValues
+              ?? parentNode.modifiedWriteValues,
+            bitRange: bitRange.map {
+              $0.lowerBound + increment..<$0.upperBound + increment
+            }))
+      }
+    }
+  }
+
+  /// Returns the names of the elements of a dimension array, or just `name`
+  /// if the item is not an array.
+  static func elementNames(
+    name: String,
+    dimensionElement: SVDDimensionElement?
+  ) -> [String] {
+    guard let dimensionElement else { return [name] }
+    let count = Int(dimensionElement.dim)
+    var indices = dimensionElement.dimIndex.map(Self.dimensionIndices) ?? []
+    if indices.count != count {
+      indices = (0..<count).map { "\($0)" }
+    }
+    return indices.map { index in
+      if name.contains("[%s]") {
+        name.replacingOccurrences(of: "[%s]", with: "[\(index)]")
+      } else if name.contains("%s") {
+        name.replacingOccurrences(of: "%s", with: index)
+      } else {
+        "\(name)\(index)"
+      }
+    }
+  }
+
+  /// Parses a `dimIndex` such as "0-3", "A-D", or "A,B,C" into its indices.
+  static func dimensionIndices(_ dimIndex: String) -> [String] {
+    let bounds = dimIndex.split(separator: "-")
+    if bounds.count == 2 {
+      if let lowerBound = Int(bounds[0]), let upperBound = Int(bounds[1]),
+        lowerBound <= upperBound
+      {
+        return (lowerBound...upperBound).map { "\($0)" }
+      }
+      if let lowerBound = bounds[0].unicodeScalars.first,
+        let upperBound = bounds[1].unicodeScalars.first,
+        bounds[0].unicodeScalars.count == 1,
+        bounds[1].unicodeScalars.count == 1,
+        lowerBound.value <= upperBound.value
+      {
+        return (lowerBound.value...upperBound.value).compactMap {
+          Unicode.Scalar($0).map { String($0) }
+        }
+      }
+    }
+    return dimIndex.split(separator: ",").map {
+      String($0).trimmingCharacters(in: .whitespaces)
+    }
+  }
+}
+
+/// An item with its own kind of node in a ``DeviceIndex``.
+protocol DeviceIndexItem: SVDItem {
+  /// The kind of the nodes of the item.
+  static var kind: DeviceIndex.Kind { get }
+  /// The storage of items of this kind in the index.
+  static var storage: WritableKeyPath<DeviceIndex, [Self]> { get }
+  /// The range of bits occupied by a field within its register.
+  var indexBitRange: Range<UInt64>? { get }
+}
+
+extension DeviceIndexItem {
+  var indexBitRange: Range<UInt64>? { nil }
+}
+
+extension SVDPeripheral: DeviceIndexItem {
+  static var kind: DeviceIndex.Kind { .peripheral }
+  static var storage: WritableKeyPath<DeviceIndex, [Self]> { \.peripherals }
+}
+
+extension SVDCluster: DeviceIndexItem {
+  static var kind: DeviceIndex.Kind { .cluster }
+  static var storage: WritableKeyPath<DeviceIndex, [Self]> { \.clusters }
+}
+
+extension SVDRegister: DeviceIndexItem {
+  static var kind: DeviceIndex.Kind { .register }
+  static var storage: WritableKeyPath<DeviceIndex, [Self]> { \.registers }
+}
+
+extension SVDField: DeviceIndexItem {
+  static var kind: DeviceIndex.Kind { .field }
+  static var storage: WritableKeyPath<DeviceIndex, [Self]> { \.fields }
+  var indexBitRange: Range<UInt64>? { self.bitRange.range }
+}
+
+extension DeviceIndex {
+  /// Returns the nodes matching each key of `pattern` in turn, starting from
+  /// the children of the device.
+  ///
+  /// Only the children whose names start with the literal prefix of a key are
+  /// tested against the key. Matches are returned in the order of the items in
+  /// the device.
+  func nodes(matching pattern: KeyPathPattern) -> [Int] {
+    var matches = [Self.root]
+    for key in pattern.keys {
+      let prefix = key.literalPrefix
+      var next: [Int] = []
+      for node in matches {
+        let children = self.nodes[node].children
+        let start = next.count
+        var position = self.firstSortedChild(of: node, notBefore: prefix)
+        while position < children.upperBound {
+          let child = self.sortedChildren[position]
+          let name = self.nodes[child].foldedName
+          guard name.utf8.starts(with: prefix) else { break }
+          if key.matches(name) {
+            next.append(child)
+          }
+          position += 1
+        }
+        next[start...].sort()
+      }
+      matches = next
+      if matches.isEmpty { break }
+    }
+    return matches
+  }
+
+  /// Returns the node at a key path of item names, matched
+  /// case-insensitively, or `nil` if there is no such item.
+  func node(at keyPath: [some StringProtocol]) -> Int? {
+    var node = Self.root
+    for key in keyPath {
+      let key = key.lowercased()
+      let position = self.firstSortedChild(of: node, notBefore: key.utf8)
+      guard
+        position < self.nodes[node].children.upperBound,
+        self.nodes[self.sortedChildren[position]].foldedName == key
+      else { return nil }
+      node = self.sortedChildren[position]
+    }
+    return node
+  }
+
+  /// Returns the position in `sortedChildren` of the first child of `node`
+  /// whose folded name is not ordered before `name`, or the end of the
+  /// node's children if there is none.
+  private func firstSortedChild(
+    of node: Int,
+    notBefore name: some Collection<UInt8>
+  ) -> Int {
+    var lowerBound = self.nodes[node].children.lowerBound
+    var upperBound = self.nodes[node].children.upperBound
+    while lowerBound < upperBound {
+      let middle = lowerBound + (upperBound - lowerBound) / 2
+      let child = self.sortedChildren[middle]
+      if self.nodes[child].foldedName.utf8.lexicographicallyPrecedes(name) {
+        lowerBound = middle + 1
+      } else {
+        upperBound = middle
+      }
+    }
+    return lowerBound
+  }
+
+  /// Returns the register of a register node.
+  func register(of node: Int) -> SVDRegister? {
+    guard self.nodes[node].kind == .register else { return nil }
+    return self.registers[self.nodes[node].item]
+  }
+
+  /// Returns the information about a node displayed by `svd info`.
+  func info(of node: Int) -> [(String, String)] {
+    let node = self.nodes[node]
+    let registerProperties = node.registerProperties
+    let address = node.address
+    return switch node.kind {
+    case .device:
+      self.device.info(
+        registerProperties: registerProperties, address: address)
+    case .peripheral:
+      self.peripherals[node.item].info(
+        registerProperties: registerProperties, address: address)
+    case .cluster:
+      self.clusters[node.item].info(
+        registerProperties: registerProperties, address: address)
+    case .register:
+      self.registers[node.item].info(
+        registerProperties: registerProperties, address: address)
+    case .field:
+      self.fields[node.item].info(
+        registerProperties: registerProperties, address: address)
+    }
+  }
+
+  /// Returns the dot separated key path of a node, excluding the device.
+  func keyPath(of node: Int) -> String {
+    var names: [String] = []
+    var node = node
+    while node != Self.root {
+      names.append(self.nodes[node].name)
+      node = self.nodes[node].parent
+    }
+    return names.reversed().joined(separator: ".")
+  }
+}
@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import MMIOUtilities
+import SVD
+
+/// A device being read, decoded, and inflated on a background thread.
+///
+/// Loading large SVD files takes multiple seconds, so `svd load` starts a
+/// `DeviceLoad` and returns immediately. Commands only block on ``wait()``
+/// when they need the device before it is ready.
+///
+/// A finished load keeps the parsed device and its indices, so devices loaded
+/// under different namespaces stay ready to use and reloading an unchanged
+/// file reuses the existing load.
+final class DeviceLoad: @unchecked Sendable {
+  enum Phase: String {
+    case pending
+    case reading
+    case decoding
+    case inflating
+    case indexing
+    case finished
+  }
+
+  struct LoadedDevice {
+    var device: SVDDevice
+    var deviceIndex: DeviceIndex
+    var completionIndex: CompletionIndex
+  }
+
+  struct State {
+    var phase: Phase
+    var result: Result<LoadedDevice, any Error>?
+    /// The time spent in each completed phase in nanoseconds.
+    var durations: [Phase: UInt64] = [:]
+    /// The time the current phase started, in nanoseconds.
+    var phaseStart: UInt64 = 0
+
+    /// Moves the load to `phase`, recording the duration of the current
+    /// phase.
+    mutating func advance(to phase: Phase) {
+      let now = DispatchTime.now().uptimeNanoseconds
+      self.durations[self.phase, default: 0] += now - self.phaseStart
+      self.phase = phase
+      self.phaseStart = now
+    }
+  }
+
+  /// The file a device is loaded from, used to detect when a file must be
+  /// reloaded.
+  struct Source: Equatable {
+    var url: URL
+    var modificationDate: Date?
+  }
+
+  /// The name of the SVD file being loaded.
+  let name: String
+  /// The file being loaded, if the device is loaded from disk.
+  let source: Source?
+  private let state: Mutex<State>
+  private let group: DispatchGroup
+
+  init(
+    name: String,
+    source: Source? = nil,
+    body: @escaping @Sendable (_ progress: (Phase) -> Void) throws -> SVDDevice
+  ) {
+    self.name = name
+    self.source = source
+    self.state = Mutex(
+      State(
+        phase: .pending,
+        result: nil,
+        phaseStart: DispatchTime.now().uptimeNanoseconds))
+    self.group = DispatchGroup()
+
+    let state = self.state
+    let group = self.group
+    group.enter()
+    DispatchQueue.global(qos: .userInitiated).async {
+      let progress = { (phase: Phase) in
+        state.withLock { $0.advance(to: phase) }
+      }
+      let result = Result<LoadedDevice, any Error> {
+        let device = try body(progress)
+        // Index the items of the device for key path lookup and completion.
+        progress(.indexing)
+        let deviceIndex = DeviceIndex(device: device)
+        return LoadedDevice(
+          device: device,
+          deviceIndex: deviceIndex,
+          completionIndex: CompletionIndex(index: deviceIndex))
+      }
+      state.withLock {
+        $0.advance(to: .finished)
+        $0.result = result
+      }
+      group.leave()
+    }
+  }
+
+  /// Creates a finished load of an already indexed device.
+  init(name: String, loadedDevice: LoadedDevice) {
+    self.name = name
+    self.source = nil
+    self.state = Mutex(
+      State(phase: .finished, result: .success(loadedDevice)))
+    self.group = DispatchGroup()
+  }
+}
+
+extension DeviceLoad.Source {
+  /// The source of the file at `url` as of now.
+  init(url: URL) {
+    let url = url.standardizedFileURL
+    let attributes = try? FileManager.default.attributesOfItem(atPath: url.path)
+    self.url = url
+    self.modificationDate = attributes?[.modificationDate] as? Date
+  }
+}
+
+extension DeviceLoad {
+  convenience init(url: URL) {
+    let source = Source(url: url)
+    self.init(name: url.lastPathComponent, source: source) { progress in
+      // Load input file from disk.
+      progress(.reading)
+      let data = try Data(contentsOf: url)
+      // Decode raw data into SVD types.
+      progress(.decoding)
+      var device = try SVDDevice(data: data)
+      // Inflate the decoded device.
+      progress(.inflating)
+      try device.inflate()
+      return device
+    }
+  }
+
+  /// Creates a finished load of `device`, indexing it immediately.
+  convenience init(device: SVDDevice) {
+    let deviceIndex = DeviceIndex(device: device)
+    self.init(
+      name: device.name,
+      loadedDevice: .init(
+        device: device,
+        deviceIndex: deviceIndex,
+        completionIndex: CompletionIndex(index: deviceIndex)))
+  }
+
+  /// The current phase of the load.
+  var phase: Phase {
+    self.state.withLock { $0.phase }
+  }
+
+  /// The time spent in each completed phase of the load in nanoseconds.
+  ///
+  /// Devices which were not loaded in the background have no durations.
+  var durations: [Phase: UInt64] {
+    self.state.withLock { $0.durations }
+  }
+
+  /// Blocks until the load finishes and returns the loaded device or the
+  /// error which caused the load to fail.
+  func wait() -> Result<LoadedDevice, any Error> {
+    self.group.wait()
+    return self.state.withLock {
+      guard let result = $0.result else {
+        preconditionFailure("DeviceLoad finished without a result")
+      }
+      return result
+    }
+  }
+}
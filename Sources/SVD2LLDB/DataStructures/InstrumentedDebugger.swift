@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// A debugger which reports the memory transactions of another debugger to
+/// the command statistics.
+struct InstrumentedDebugger<Base: SVD2LLDBDebugger> {
+  var base: Base
+  var statistics: CommandStatistics
+}
+
+extension InstrumentedDebugger {
+  /// Measures a memory transaction of `bytes` bytes at `address` performed
+  /// by `body`.
+  mutating func transaction<T>(
+    address: UInt64,
+    write: Bool,
+    bytes: Int,
+    _ body: (inout Base) throws -> T
+  ) rethrows -> T {
+    let span = self.statistics.begin(.memory)
+    defer {
+      let time = self.statistics.end(span)
+      let direction = write ? "<-" : "->"
+      self.statistics.recordTransaction(
+        "m[\(hex: address)] \(direction) \(bytes) byte\(bytes == 1 ? "" : "s")",
+        bytes: bytes,
+        time: time)
+    }
+    return try body(&self.base)
+  }
+}
+
+extension InstrumentedDebugger: SVD2LLDBDebugger {
+  mutating func read(
+    address: UInt64,
+    bits: some FixedWidthInteger
+  ) throws -> UInt64 {
+    let bytes = Int(bits.roundUp(toMultipleOf: 8) / 8)
+    return try self.transaction(address: address, write: false, bytes: bytes) {
+      try $0.read(address: address, bits: bits)
+    }
+  }
+
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    try self.transaction(address: address, write: false, bytes: count) {
+      try $0.read(address: address, count: count)
+    }
+  }
+
+  mutating func read(
+    blocks: [(address: UInt64, count: Int)]
+  ) throws -> [[UInt8]?] {
+    // Batched reads may overlap, so only the time of the whole batch is
+    // known.
+    let span = self.statistics.begin(.memory)
+    defer {
+      let time = self.statistics.end(span)
+      self.statistics.recordTransactions(
+        blocks.map { block in
+          let count = block.count
+          let description =
+            "m[\(hex: block.address)] -> \(count) byte\(count == 1 ? "" : "s")"
+          return (description, count)
+        },
+        time: time)
+    }
+    return try self.base.read(blocks: blocks)
+  }
+
+  mutating func write(
+    address: UInt64,
+    value: UInt64,
+    bits: some FixedWidthInteger
+  ) throws {
+    let bytes = Int(bits.roundUp(toMultipleOf: 8) / 8)
+    try self.transaction(address: address, write: true, bytes: bytes) {
+      try $0.write(address: address, value: value, bits: bits)
+    }
+  }
+
+  mutating func stopID() -> UInt64? {
+    self.base.stopID()
+  }
+}
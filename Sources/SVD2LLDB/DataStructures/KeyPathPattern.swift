@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A case-insensitive key path which may contain glob and index range
+/// patterns.
+///
+/// Each key of the pattern may contain `*` to match any sequence of
+/// characters, `?` to match any single character, and `[a..b]` or `[n]` to
+/// match an index between `a` and `b` inclusive, written either as a bare
+/// number or in brackets. For example "uart*.cr?" or "dma.ch[0..7].ctrl".
+struct KeyPathPattern {
+  enum Token: Equatable {
+    case literal([UInt8])
+    case anyCharacters
+    case anyCharacter
+    case range(ClosedRange<Int>)
+  }
+
+  struct Key: Equatable {
+    var tokens: [Token]
+  }
+
+  var keys: [Key]
+}
+
+extension KeyPathPattern {
+  /// Compiles `string` into a pattern or returns `nil` if it is not a valid
+  /// key path.
+  init?(_ string: String) {
+    self.keys = []
+    var tokens: [Token] = []
+    var literal: [UInt8] = []
+    var bytes = Array(string.lowercased().utf8)[...]
+
+    func endLiteral() {
+      guard !literal.isEmpty else { return }
+      tokens.append(.literal(literal))
+      literal = []
+    }
+
+    while let byte = bytes.popFirst() {
+      switch byte {
+      case UInt8(ascii: "."):
+        endLiteral()
+        guard !tokens.isEmpty else { return nil }
+        self.keys.append(Key(tokens: tokens))
+        tokens = []
+      case UInt8(ascii: "*"):
+        endLiteral()
+        if tokens.last != .anyCharacters {
+          tokens.append(.anyCharacters)
+        }
+      case UInt8(ascii: "?"):
+        endLiteral()
+        tokens.append(.anyCharacter)
+      case UInt8(ascii: "["):
+        guard let end = bytes.firstIndex(of: UInt8(ascii: "]")) else {
+          return nil
+        }
+        let contents = String(decoding: bytes[..<end], as: UTF8.self)
+        bytes = bytes[bytes.index(after: end)...]
+        if let range = Self.range(contents) {
+          endLiteral()
+          tokens.append(.range(range))
+        } else {
+          // Not an index range, match the brackets literally.
+          literal.append(UInt8(ascii: "["))
+          literal.append(contentsOf: contents.utf8)
+          literal.append(UInt8(ascii: "]"))
+        }
+      default:
+        literal.append(byte)
+      }
+    }
+    endLiteral()
+    guard !tokens.isEmpty else { return nil }
+    self.keys.append(Key(tokens: tokens))
+  }
+
+  static func range(_ contents: String) -> ClosedRange<Int>? {
+    let bounds = contents.split(
+      separator: "..", maxSplits: 1, omittingEmptySubsequences: false)
+    guard
+      let lowerBound = bounds.first.flatMap({ Int($0) }),
+      let upperBound = bounds.last.flatMap({ Int($0) }),
+      lowerBound >= 0,
+      lowerBound <= upperBound
+    else { return nil }
+    return lowerBound...upperBound
+  }
+}
+
+extension KeyPathPattern.Key {
+  /// The name matched by this key if it contains no patterns.
+  var literal: String? {
+    guard self.tokens.count == 1, case .literal(let bytes) = self.tokens[0]
+    else { return nil }
+    return String(decoding: bytes, as: UTF8.self)
+  }
+
+  /// The bytes every name matched by this key starts with.
+  var literalPrefix: [UInt8] {
+    guard case .literal(let bytes) = self.tokens.first else { return [] }
+    return bytes
+  }
+
+  /// Returns whether the key matches the lowercased name of an item.
+  func matches(_ foldedName: String) -> Bool {
+    if let literal = self.literal {
+      return literal == foldedName
+    }
+    return Self.matches(self.tokens[...], Array(foldedName.utf8)[...])
+  }
+
+  private static func matches(
+    _ tokens: ArraySlice<KeyPathPattern.Token>,
+    _ name: ArraySlice<UInt8>
+  ) -> Bool {
+    guard let token = tokens.first else { return name.isEmpty }
+    let tokens = tokens.dropFirst()
+    switch token {
+    case .literal(let literal):
+      guard name.starts(with: literal) else { return false }
+      return Self.matches(tokens, name.dropFirst(literal.count))
+    case .anyCharacter:
+      guard !name.isEmpty else { return false }
+      return Self.matches(tokens, name.dropFirst())
+    case .anyCharacters:
+      for start in name.indices + [name.endIndex]
+      where Self.matches(tokens, name[start...]) {
+        return true
+      }
+      return false
+    case .range(let range):
+      // Match the index with or without surrounding brackets.
+      var name = name
+      let bracketed = name.first == UInt8(ascii: "[")
+      if bracketed { name = name.dropFirst() }
+      var value = 0
+      var digits = name
+      while let digit = digits.first,
+        UInt8(ascii: "0") <= digit, digit <= UInt8(ascii: "9")
+      {
+        value = value * 10 + Int(digit - UInt8(ascii: "0"))
+        digits = digits.dropFirst()
+        // Stop once the index is too large to ever be in range.
+        guard value <= range.upperBound else { break }
+        guard range.contains(value) else { continue }
+        var rest = digits
+        if bracketed {
+          guard rest.first == UInt8(ascii: "]") else { continue }
+          rest = rest.dropFirst()
+        }
+        if Self.matches(tokens, rest) { return true }
+      }
+      return false
+    }
+  }
+}
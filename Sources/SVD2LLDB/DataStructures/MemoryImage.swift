@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import MMIOUtilities
+
+/// Target memory captured in a file, such as a raw dump of a memory region or
+/// an ELF core file.
+///
+/// Files are memory mapped instead of read, so inspecting a few registers of a
+/// large dump only touches the pages containing those registers.
+package struct MemoryImage: Sendable {
+  /// A range of target addresses backed by bytes of the file.
+  struct Segment {
+    var address: UInt64
+    /// The offset of the first byte of the segment in the file.
+    var offset: Int
+    var count: Int
+  }
+
+  /// The name of the file, used in diagnostics.
+  package var name: String
+  var data: Data
+  /// The segments of the image, in ascending address order.
+  var segments: [Segment]
+}
+
+extension MemoryImage {
+  /// Maps a raw memory dump whose first byte is at `baseAddress`, or an ELF
+  /// file whose loadable segments describe the captured memory if
+  /// `baseAddress` is `nil`.
+  package init(contentsOf url: URL, baseAddress: UInt64?) throws {
+    let data: Data
+    do {
+      data = try Data(contentsOf: url, options: .alwaysMapped)
+    } catch {
+      throw GenericError("Failed to read memory image “\(url.path)”: \(error)")
+    }
+    let name = url.lastPathComponent
+    let segments =
+      if let baseAddress {
+        [Segment(address: baseAddress, offset: 0, count: data.count)]
+      } else {
+        try Self.elfSegments(data: data, name: name)
+      }
+    self.init(name: name, data: data, segments: segments)
+  }
+
+  /// Returns `count` bytes of target memory starting at `address`.
+  ///
+  /// The bytes must all be captured by a single segment of the image.
+  func bytes(at address: UInt64, count: Int) throws -> [UInt8] {
+    // Find the last segment starting at or before the address.
+    var lowerBound = 0
+    var upperBound = self.segments.count
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      if self.segments[middle].address <= address {
+        lowerBound = middle + 1
+      } else {
+        upperBound = middle
+      }
+    }
+    guard lowerBound > 0 else {
+      throw self.unmappedAddressError(address)
+    }
+    let segment = self.segments[lowerBound - 1]
+    let offset = address - segment.address
+    guard
+      count >= 0,
+      offset <= UInt64(segment.count),
+      UInt64(count) <= UInt64(segment.count) - offset
+    else {
+      throw self.unmappedAddressError(address)
+    }
+    let start = self.data.startIndex + segment.offset + Int(offset)
+    return [UInt8](self.data[start..<start + count])
+  }
+
+  func unmappedAddressError(_ address: UInt64) -> GenericError {
+    GenericError(
+      "Address \(hex: address) is not captured by memory image “\(self.name)”.")
+  }
+}
+
+// MARK: - ELF
+extension MemoryImage {
+  /// The ELF program header type of loadable segments.
+  static let loadableSegment: UInt64 = 1
+
+  /// Returns the segments described by the loadable program headers of a
+  /// little-endian ELF file, such as a core file.
+  static func elfSegments(data: Data, name: String) throws -> [Segment] {
+    let invalid = GenericError("Invalid ELF file “\(name)”.")
+
+    // Reads a little-endian integer from the file.
+    func integer(at offset: UInt64, size: Int) throws -> UInt64 {
+      guard
+        let offset = Int(exactly: offset),
+        size <= data.count,
+        offset <= data.count - size
+      else { throw invalid }
+      var value: UInt64 = 0
+      for byte in 0..<size {
+        value |= UInt64(data[data.startIndex + offset + byte]) << (byte * 8)
+      }
+      return value
+    }
+
+    guard data.starts(with: [0x7f, 0x45, 0x4c, 0x46]) else {
+      throw GenericError(
+        """
+        Memory image “\(name)” is not an ELF file. Specify the base address \
+        of raw memory images.
+        """)
+    }
+    // The class and data encoding of the file in e_ident.
+    let wide: Bool
+    switch try integer(at: 4, size: 1) {
+    case 1: wide = false
+    case 2: wide = true
+    default: throw invalid
+    }
+    guard try integer(at: 5, size: 1) == 1 else {
+      throw GenericError("Big-endian ELF file “\(name)” is not supported.")
+    }
+
+    // The location of the program header table in the ELF header.
+    let tableOffset = try integer(at: wide ? 0x20 : 0x1c, size: wide ? 8 : 4)
+    let entrySize = try integer(at: wide ? 0x36 : 0x2a, size: 2)
+    let entryCount = try integer(at: wide ? 0x38 : 0x2c, size: 2)
+    guard tableOffset <= UInt64(data.count) else { throw invalid }
+
+    var segments: [Segment] = []
+    for entry in 0..<entryCount {
+      let header = tableOffset + entry * entrySize
+      guard try integer(at: header, size: 4) == Self.loadableSegment else {
+        continue
+      }
+      // p_offset, p_vaddr, and p_filesz of the program header.
+      let word = wide ? 8 : 4
+      let fields: (UInt64, UInt64, UInt64) = wide ? (8, 16, 32) : (4, 8, 16)
+      let offset = try integer(at: header + fields.0, size: word)
+      let address = try integer(at: header + fields.1, size: word)
+      let count = try integer(at: header + fields.2, size: word)
+      // Segments which only occupy memory, such as .bss, were not captured.
+      guard count > 0 else { continue }
+      guard
+        let offset = Int(exactly: offset),
+        let count = Int(exactly: count),
+        offset <= data.count,
+        count <= data.count - offset
+      else { throw invalid }
+      segments.append(.init(address: address, offset: offset, count: count))
+    }
+
+    guard !segments.isEmpty else {
+      throw GenericError("ELF file “\(name)” has no loadable segments.")
+    }
+    return segments.sorted { $0.address < $1.address }
+  }
+}
+
+// MARK: - Offline reads
+extension MemoryImage {
+  /// A debugger which reads target memory from a memory image instead of a
+  /// target.
+  struct Debugger {
+    var image: MemoryImage
+  }
+}
+
+extension MemoryImage.Debugger: SVD2LLDBDebugger {
+  mutating func read(
+    address: UInt64,
+    bits: some FixedWidthInteger
+  ) throws -> UInt64 {
+    let bits = UInt64(bits)
+    guard 0 < bits, bits <= 64 else {
+      throw GenericError("Invalid register size “\(bits)” bits.")
+    }
+    // Memory images are little-endian, like the targets SVD2LLDB supports.
+    let bytes = try self.image.bytes(
+      at: address,
+      count: Int(bits.roundUp(toMultipleOf: 8) / 8))
+    var value: UInt64 = 0
+    for (index, byte) in bytes.enumerated() {
+      value |= UInt64(byte) << (index * 8)
+    }
+    return bits < 64 ? value & ((1 << bits) &- 1) : value
+  }
+
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    try self.image.bytes(at: address, count: count)
+  }
+
+  mutating func write(
+    address: UInt64,
+    value: UInt64,
+    bits: some FixedWidthInteger
+  ) throws {
+    throw GenericError("Memory images are read-only.")
+  }
+
+  mutating func stopID() -> UInt64? {
+    // The contents of an image never change, so register values read from it
+    // may always be cached.
+    0
+  }
+}
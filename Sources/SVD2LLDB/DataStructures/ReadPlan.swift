@@ -0,0 +1,216 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// A batch of register reads ordered by address and coalesced into as few
+/// memory transactions as possible.
+///
+/// Registers without side-effects which are close together in memory are
+/// merged into a single block read and their values are sliced out of the
+/// returned bytes. Registers with side-effects are always read individually
+/// using their natural access width, and block reads never span a barrier,
+/// such as a register with side-effects which is not being read. Registers
+/// wider than 64 bits are always read with a single block read of the whole
+/// register, never piecemeal.
+struct ReadPlan {
+  struct Options {
+    /// The largest number of unrequested bytes which may be read between two
+    /// registers to merge them into a single transaction.
+    var maximumGap: UInt64
+    /// The largest number of bytes read by a single transaction.
+    var maximumBlockSize: UInt64
+  }
+
+  struct Read {
+    var address: UInt64
+    var bits: UInt64
+    /// Whether the read may be merged with other reads into a single
+    /// transaction.
+    var coalescable: Bool
+  }
+
+  struct Transaction {
+    var address: UInt64
+    var byteCount: UInt64
+    /// Indices of the reads serviced by this transaction.
+    var reads: [Int]
+  }
+
+  var reads: [Read]
+  var transactions: [Transaction]
+}
+
+extension ReadPlan.Options {
+  static let `default` = Self(maximumGap: 0, maximumBlockSize: 1024)
+}
+
+extension ReadPlan.Read {
+  var byteCount: UInt64 {
+    self.bits.roundUp(toMultipleOf: 8) / 8
+  }
+}
+
+extension ReadPlan.Transaction {
+  var endAddress: UInt64 {
+    self.address + self.byteCount
+  }
+}
+
+extension ReadPlan {
+  init(reads: [Read], barriers: [Range<UInt64>] = [], options: Options) {
+    self.reads = reads
+    self.transactions = []
+    // Barriers are merged once so each gap is checked with a binary search.
+    let barriers = barriers.merged()
+
+    // Visit the reads in address order, extending the previous transaction
+    // when possible and starting a new transaction otherwise.
+    let order = reads.indices.sorted {
+      (reads[$0].address, $0) < (reads[$1].address, $1)
+    }
+    var previousCoalescable = false
+    for index in order {
+      let read = reads[index]
+      let coalescable = read.coalescable
+      let endAddress = read.address + read.byteCount
+      if coalescable, previousCoalescable,
+        var transaction = self.transactions.last,
+        read.address <= transaction.endAddress + options.maximumGap,
+        max(endAddress, transaction.endAddress) - transaction.address
+          <= options.maximumBlockSize,
+        !barriers.mergedRangesOverlap(
+          transaction.endAddress..<max(transaction.endAddress, read.address))
+      {
+        transaction.byteCount =
+          max(endAddress, transaction.endAddress) - transaction.address
+        transaction.reads.append(index)
+        self.transactions[self.transactions.count - 1] = transaction
+      } else {
+        self.transactions.append(
+          .init(
+            address: read.address,
+            byteCount: read.byteCount,
+            reads: [index]))
+      }
+      previousCoalescable = coalescable
+    }
+  }
+
+  /// Performs the transactions of the plan and returns the value of each
+  /// read, in the order the reads were provided, or `nil` if it failed.
+  ///
+  /// Reads wider than 64 bits are `nil` in the returned values, use
+  /// ``execute(debugger:wideValues:)`` to retrieve them.
+  func execute(debugger: inout some SVD2LLDBDebugger) -> [UInt64?] {
+    var wideValues: [Int: WideValue] = [:]
+    return self.execute(debugger: &debugger, wideValues: &wideValues)
+  }
+
+  /// Performs the transactions of the plan and returns the value of each
+  /// read, in the order the reads were provided, or `nil` if it failed.
+  ///
+  /// The values of reads wider than 64 bits are stored in `wideValues` keyed
+  /// by the index of the read instead.
+  func execute(
+    debugger: inout some SVD2LLDBDebugger,
+    wideValues: inout [Int: WideValue]
+  ) -> [UInt64?] {
+    var values = [UInt64?](repeating: nil, count: self.reads.count)
+    var next = 0
+    while next < self.transactions.count {
+      // Perform consecutive block reads as a single batch so debuggers which
+      // pipeline memory transactions can overlap them.
+      var end = next
+      while end < self.transactions.count,
+        self.transactions[end].reads.count > 1
+      {
+        end += 1
+      }
+      guard end > next else {
+        self.readIndividually(
+          transaction: self.transactions[next],
+          debugger: &debugger,
+          values: &values,
+          wideValues: &wideValues)
+        next += 1
+        continue
+      }
+
+      let batch = self.transactions[next..<end]
+      let blocks: [[UInt8]?]
+      do {
+        blocks = try debugger.read(
+          blocks: batch.map { ($0.address, Int($0.byteCount)) })
+      } catch {
+        // The debugger can no longer read memory, fail the remaining reads
+        // instead of attempting each of them individually.
+        return values
+      }
+      for (transaction, bytes) in zip(batch, blocks) {
+        guard let bytes else {
+          // Fall back to reading registers individually if the block read
+          // failed.
+          self.readIndividually(
+            transaction: transaction,
+            debugger: &debugger,
+            values: &values,
+            wideValues: &wideValues)
+          continue
+        }
+        // Slice each register's little-endian value out of the block.
+        for index in transaction.reads {
+          let read = self.reads[index]
+          let offset = Int(read.address - transaction.address)
+          let bytes = bytes[offset..<offset + Int(read.byteCount)]
+          if read.bits > 64 {
+            wideValues[index] = WideValue(bytes: bytes, bits: read.bits)
+            continue
+          }
+          var value: UInt64 = 0
+          for (byte, shift) in zip(bytes, stride(from: 0, to: 64, by: 8)) {
+            value |= UInt64(byte) << shift
+          }
+          values[index] = value
+        }
+      }
+      next = end
+    }
+    return values
+  }
+
+  /// Reads each register of a transaction individually, used when the
+  /// transaction only services a single read or its block read failed.
+  ///
+  /// Wide registers are still read whole with a single block read.
+  func readIndividually(
+    transaction: Transaction,
+    debugger: inout some SVD2LLDBDebugger,
+    values: inout [UInt64?],
+    wideValues: inout [Int: WideValue]
+  ) {
+    for index in transaction.reads {
+      let read = self.reads[index]
+      if read.bits > 64 {
+        let bytes = try? debugger.read(
+          address: read.address,
+          count: Int(read.byteCount))
+        wideValues[index] = bytes.map {
+          WideValue(bytes: $0, bits: read.bits)
+        }
+        continue
+      }
+      values[index] = try? debugger.read(
+        address: read.address,
+        bits: read.bits)
+    }
+  }
+}
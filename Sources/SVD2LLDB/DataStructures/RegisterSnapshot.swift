@@ -0,0 +1,313 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// The values of the registers of a device captured at a single point in
+/// time.
+///
+/// Values are stored in packed arrays sorted by address. Snapshots are saved
+/// in a compact binary format:
+///
+/// - The magic bytes "SVDS" followed by a version byte.
+/// - The 64-bit little-endian fingerprint of the device's registers.
+/// - The number of registers, then the address of each register as the
+///   difference from the previous address followed by its value, all encoded
+///   as unsigned LEB128.
+struct RegisterSnapshot {
+  /// The ``DeviceIndex/fingerprint`` of the device the snapshot was taken
+  /// from.
+  var fingerprint: UInt64
+  /// Register addresses in ascending order.
+  var addresses: [UInt64]
+  /// The value of the register at the same position in `addresses`.
+  var values: [UInt64]
+}
+
+extension RegisterSnapshot {
+  static let magic = Array("SVDS".utf8)
+  static let version: UInt8 = 1
+
+  init(fingerprint: UInt64, values: [UInt64: UInt64]) {
+    let values = values.sorted { $0.key < $1.key }
+    self.fingerprint = fingerprint
+    self.addresses = values.map(\.key)
+    self.values = values.map(\.value)
+  }
+
+  /// Returns the value of the register at `address`, if present.
+  func value(at address: UInt64) -> UInt64? {
+    var lowerBound = 0
+    var upperBound = self.addresses.count
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      if self.addresses[middle] < address {
+        lowerBound = middle + 1
+      } else {
+        upperBound = middle
+      }
+    }
+    guard lowerBound < self.addresses.count,
+      self.addresses[lowerBound] == address
+    else { return nil }
+    return self.values[lowerBound]
+  }
+}
+
+// MARK: - Comparison
+extension RegisterSnapshot {
+  /// A register whose value differs between two snapshots.
+  struct Difference: Equatable {
+    var address: UInt64
+    /// The value in the first snapshot, or `nil` if the register is missing.
+    var old: UInt64?
+    /// The value in the second snapshot, or `nil` if the register is missing.
+    var new: UInt64?
+  }
+
+  /// Returns the registers whose values differ from `other`, including
+  /// registers present in only one of the snapshots, in address order.
+  func differences(to other: RegisterSnapshot) -> [Difference] {
+    // Snapshots of the same registers share their addresses, compare their
+    // packed values directly.
+    if self.addresses == other.addresses {
+      return Self.mismatches(self.values, other.values).map {
+        .init(
+          address: self.addresses[$0],
+          old: self.values[$0],
+          new: other.values[$0])
+      }
+    }
+
+    // Otherwise merge the two address lists.
+    var differences: [Difference] = []
+    var lhs = 0
+    var rhs = 0
+    while lhs < self.addresses.count, rhs < other.addresses.count {
+      let lhsAddress = self.addresses[lhs]
+      let rhsAddress = other.addresses[rhs]
+      if lhsAddress == rhsAddress {
+        if self.values[lhs] != other.values[rhs] {
+          differences.append(
+            .init(
+              address: lhsAddress,
+              old: self.values[lhs],
+              new: other.values[rhs]))
+        }
+        lhs += 1
+        rhs += 1
+      } else if lhsAddress < rhsAddress {
+        differences.append(
+          .init(address: lhsAddress, old: self.values[lhs], new: nil))
+        lhs += 1
+      } else {
+        differences.append(
+          .init(address: rhsAddress, old: nil, new: other.values[rhs]))
+        rhs += 1
+      }
+    }
+    for index in lhs..<self.addresses.count {
+      let address = self.addresses[index]
+      differences.append(
+        .init(address: address, old: self.values[index], new: nil))
+    }
+    for index in rhs..<other.addresses.count {
+      let address = other.addresses[index]
+      differences.append(
+        .init(address: address, old: nil, new: other.values[index]))
+    }
+    return differences
+  }
+
+  /// Returns the positions at which two equally long arrays of values differ.
+  ///
+  /// Values are compared a vector at a time and only vectors containing a
+  /// difference are compared element by element, so scanning mostly equal
+  /// snapshots costs little more than reading them.
+  static func mismatches(_ lhs: [UInt64], _ rhs: [UInt64]) -> [Int] {
+    precondition(lhs.count == rhs.count)
+    typealias Vector = SIMD8<UInt64>
+    let width = Vector.scalarCount
+    let stride = MemoryLayout<UInt64>.stride
+    var mismatches: [Int] = []
+    lhs.withUnsafeBytes { lhsBytes in
+      rhs.withUnsafeBytes { rhsBytes in
+        var chunk = 0
+        while chunk + width <= lhs.count {
+          let offset = chunk * stride
+          let lhsVector = lhsBytes.loadUnaligned(
+            fromByteOffset: offset,
+            as: Vector.self)
+          let rhsVector = rhsBytes.loadUnaligned(
+            fromByteOffset: offset,
+            as: Vector.self)
+          if any(lhsVector .!= rhsVector) {
+            for lane in 0..<width where lhsVector[lane] != rhsVector[lane] {
+              mismatches.append(chunk + lane)
+            }
+          }
+          chunk += width
+        }
+        for index in chunk..<lhs.count where lhs[index] != rhs[index] {
+          mismatches.append(index)
+        }
+      }
+    }
+    return mismatches
+  }
+}
+
+// MARK: - Serialization
+extension RegisterSnapshot {
+  func encoded() -> [UInt8] {
+    var bytes = Self.magic
+    bytes.append(Self.version)
+    for byte in 0..<8 {
+      bytes.append(UInt8(truncatingIfNeeded: self.fingerprint >> (byte * 8)))
+    }
+    Self.encode(UInt64(self.addresses.count), into: &bytes)
+    var previousAddress: UInt64 = 0
+    for (address, value) in zip(self.addresses, self.values) {
+      Self.encode(address - previousAddress, into: &bytes)
+      Self.encode(value, into: &bytes)
+      previousAddress = address
+    }
+    return bytes
+  }
+
+  /// Decodes a snapshot, returning `nil` if the bytes are not a valid
+  /// snapshot.
+  init?(bytes: [UInt8]) {
+    var bytes = bytes[...]
+    guard bytes.starts(with: Self.magic) else { return nil }
+    bytes.removeFirst(Self.magic.count)
+    guard bytes.popFirst() == Self.version, bytes.count >= 8 else {
+      return nil
+    }
+    self.fingerprint = 0
+    for byte in 0..<8 {
+      self.fingerprint |= UInt64(bytes.removeFirst()) << (byte * 8)
+    }
+
+    // Each register occupies at least two bytes, use that to bound the count
+    // before reserving capacity.
+    guard
+      let count = Self.decode(&bytes),
+      count <= UInt64(bytes.count / 2)
+    else { return nil }
+    self.addresses = []
+    self.values = []
+    self.addresses.reserveCapacity(Int(count))
+    self.values.reserveCapacity(Int(count))
+    var address: UInt64 = 0
+    for index in 0..<count {
+      guard
+        let delta = Self.decode(&bytes),
+        let value = Self.decode(&bytes),
+        index == 0 || delta > 0
+      else { return nil }
+      let (nextAddress, overflow) = address.addingReportingOverflow(delta)
+      guard !overflow else { return nil }
+      address = nextAddress
+      self.addresses.append(address)
+      self.values.append(value)
+    }
+    guard bytes.isEmpty else { return nil }
+  }
+
+  static func encode(_ value: UInt64, into bytes: inout [UInt8]) {
+    var value = value
+    repeat {
+      var byte = UInt8(truncatingIfNeeded: value & 0x7f)
+      value >>= 7
+      if value != 0 { byte |= 0x80 }
+      bytes.append(byte)
+    } while value != 0
+  }
+
+  static func decode(_ bytes: inout ArraySlice<UInt8>) -> UInt64? {
+    var value: UInt64 = 0
+    var shift: UInt64 = 0
+    while let byte = bytes.popFirst() {
+      guard shift < 64 else { return nil }
+      value |= UInt64(byte & 0x7f) << shift
+      if byte & 0x80 == 0 { return value }
+      shift += 7
+    }
+    return nil
+  }
+}
+
+// MARK: - Offline reads
+extension RegisterSnapshot {
+  /// A debugger which reads register values from a snapshot instead of a
+  /// target.
+  struct Debugger {
+    var snapshot: RegisterSnapshot
+  }
+}
+
+extension RegisterSnapshot.Debugger: SVD2LLDBDebugger {
+  mutating func read(
+    address: UInt64,
+    bits: some FixedWidthInteger
+  ) throws -> UInt64 {
+    guard let value = self.snapshot.value(at: address) else {
+      throw GenericError("Register at \(hex: address) is not in the snapshot.")
+    }
+    return bits < 64 ? value & ((1 << bits) &- 1) : value
+  }
+
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    throw GenericError("Snapshots only contain whole registers.")
+  }
+
+  mutating func write(
+    address: UInt64,
+    value: UInt64,
+    bits: some FixedWidthInteger
+  ) throws {
+    throw GenericError("Snapshots are read-only.")
+  }
+
+  mutating func stopID() -> UInt64? {
+    nil
+  }
+}
+
+extension DeviceIndex {
+  /// A hash of the name, address, and size of every register in the device,
+  /// used to match snapshots to the device they were taken from.
+  var fingerprint: UInt64 {
+    // 64-bit FNV-1a.
+    var hash: UInt64 = 0xcbf2_9ce4_8422_2325
+    func combine(_ byte: UInt8) {
+      hash = (hash ^ UInt64(byte)) &* 0x0000_0100_0000_01b3
+    }
+    func combine(_ value: UInt64) {
+      for byte in 0..<8 {
+        combine(UInt8(truncatingIfNeeded: value >> (byte * 8)))
+      }
+    }
+    for node in self.nodes where node.kind == .register {
+      for byte in node.foldedName.utf8 {
+        combine(byte)
+      }
+      combine(UInt8(0))
+      combine(node.address)
+      combine(node.size)
+    }
+    return hash
+  }
+}
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// Register values read from the target while its process remains stopped.
+///
+/// Only registers without side-effects may be stored in the cache. All values
+/// are discarded when the process resumes or any register is written.
+final class RegisterValueCache {
+  struct Key: Hashable {
+    var address: UInt64
+    var bits: UInt64
+  }
+
+  private var stopID: UInt64?
+  private var values: [Key: UInt64]
+
+  init() {
+    self.stopID = nil
+    self.values = [:]
+  }
+}
+
+extension RegisterValueCache {
+  /// Discards all values if the process has resumed since they were read.
+  ///
+  /// Values are never cached while `stopID` is `nil`.
+  func synchronize(stopID: UInt64?) {
+    if stopID == nil || stopID != self.stopID {
+      self.values.removeAll(keepingCapacity: true)
+    }
+    self.stopID = stopID
+  }
+
+  /// Discards all values, for example after writing to the target.
+  func invalidate() {
+    self.values.removeAll(keepingCapacity: true)
+  }
+
+  subscript(address address: UInt64, bits bits: UInt64) -> UInt64? {
+    get {
+      self.values[.init(address: address, bits: bits)]
+    }
+    set {
+      guard self.stopID != nil else { return }
+      self.values[.init(address: address, bits: bits)] = newValue
+    }
+  }
+}
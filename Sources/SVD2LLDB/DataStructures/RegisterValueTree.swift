@@ -11,48 +11,144 @@
 
 import MMIOUtilities
 
-final class ValueTree {
+/// A tree of register values to display to the user.
+///
+/// Nodes are stored as parallel arrays in a single arena and referenced by
+/// position, like ``DeviceIndex``. Nodes are only ever appended and the
+/// children of each node form a singly linked list in insertion order, so
+/// building a tree performs no per-node allocations and walking it touches
+/// contiguous memory. The root is never a child or sibling of another node, so
+/// `root` also marks the end of a child list.
+struct ValueTree {
   enum Value {
     case data(UInt64, UInt64)
+    /// The value of a register or field wider than 64 bits.
+    case wideData(WideValue)
+    case changed(Change)
     case skipped
+    /// The register is outside the address blocks of its peripheral.
+    case unmapped
+    /// The register is not stored in the snapshot being decoded.
+    case notCaptured
     case error
   }
 
-  var name: String
-  var value: Value?
-  var children: [ValueTree]
-
-  init(name: String, value: Value?, children: [ValueTree]) {
-    self.name = name
-    self.value = value
-    self.children = children
+  /// A value which differs between two register snapshots.
+  struct Change {
+    /// The previous value, or `nil` if the register was not present.
+    var old: UInt64?
+    /// The current value, or `nil` if the register was not present.
+    var new: UInt64?
+    var bits: UInt64
+    /// The names of the enumerated values matching the old and new values.
+    var oldName: String?
+    var newName: String?
   }
+
+  var names: [String]
+  /// The position of each node among its siblings when displayed: the
+  /// address of containers and registers, or the bit offset of fields.
+  var keys: [UInt64]
+  var values: [Value?]
+  var parents: [Int]
+  var firstChildren: [Int]
+  var lastChildren: [Int]
+  var nextSiblings: [Int]
 }
 
 extension ValueTree {
-  static func container(name: String) -> Self {
-    .init(name: name, value: nil, children: [])
+  static let root = 0
+
+  /// Creates a tree containing only a root node with no value.
+  init(name: String) {
+    self.names = [name]
+    self.keys = [0]
+    self.values = [nil]
+    self.parents = [Self.root]
+    self.firstChildren = [Self.root]
+    self.lastChildren = [Self.root]
+    self.nextSiblings = [Self.root]
+  }
+
+  var count: Int { self.names.count }
+
+  /// Appends a node as the last child of `parent` and returns it.
+  mutating func append(
+    name: String,
+    key: UInt64 = 0,
+    value: Value? = nil,
+    parent: Int
+  ) -> Int {
+    let node = self.names.count
+    self.names.append(name)
+    self.keys.append(key)
+    self.values.append(value)
+    self.parents.append(parent)
+    self.firstChildren.append(Self.root)
+    self.lastChildren.append(Self.root)
+    self.nextSiblings.append(Self.root)
+    if self.firstChildren[parent] == Self.root {
+      self.firstChildren[parent] = node
+    } else {
+      self.nextSiblings[self.lastChildren[parent]] = node
+    }
+    self.lastChildren[parent] = node
+    return node
   }
 
-  func child(name: String) -> ValueTree? {
-    self.children.first { $0.name == name }
+  /// Returns the children of a node in insertion order.
+  func children(of node: Int) -> Children {
+    Children(nextSiblings: self.nextSiblings, first: self.firstChildren[node])
+  }
+
+  func hasChildren(_ node: Int) -> Bool {
+    self.firstChildren[node] != Self.root
+  }
+
+  /// Returns whether `node` is displayed before its sibling `other`, ordering
+  /// siblings by key and then by name.
+  func precedes(_ node: Int, _ other: Int) -> Bool {
+    (self.keys[node], self.names[node]) < (self.keys[other], self.names[other])
   }
 }
 
-extension ValueTree: CustomStringConvertible {
-  var description: String {
-    self._description(prefix: "")
+extension ValueTree {
+  /// The children of a node, walked through the sibling links without
+  /// copying.
+  struct Children: Sequence, IteratorProtocol {
+    var nextSiblings: [Int]
+    var node: Int
+
+    init(nextSiblings: [Int], first: Int) {
+      self.nextSiblings = nextSiblings
+      self.node = first
+    }
+
+    mutating func next() -> Int? {
+      guard self.node != ValueTree.root else { return nil }
+      defer { self.node = self.nextSiblings[self.node] }
+      return self.node
+    }
   }
+}
 
-  func _description(prefix: String) -> String {
+extension ValueTree: CustomStringConvertible {
+  var description: String {
     var description = ""
-    description.append("\(prefix)\(self.name):")
-    if let value = self.value {
-      description.append(" \(value)")
-    }
-    description.append("\n")
-    for child in self.children {
-      description.append(child._description(prefix: prefix + "  "))
+    var queue = [(Self.root, 0)]
+    while let (node, depth) = queue.popLast() {
+      description.append(String(repeating: " ", count: depth))
+      description.append("\(self.names[node]):")
+      if let value = self.values[node] {
+        description.append(" \(value)")
+      }
+      description.append("\n")
+      // Push children in reverse so they are printed in order.
+      let start = queue.count
+      for child in self.children(of: node) {
+        queue.append((child, depth + 2))
+      }
+      queue[start...].reverse()
     }
     return description
   }
@@ -62,8 +158,31 @@ extension ValueTree.Value: CustomStringConvertible {
   var description: String {
     switch self {
     case .data(let value, let bits): "\(hex: value, bits: bits)"
+    case .wideData(let value): "\(value)"
+    case .changed(let change): "\(change)"
     case .skipped: "<skipped>"
+    case .unmapped: "<unmapped>"
+    case .notCaptured: "<not captured>"
     case .error: "<error>"
     }
   }
 }
+
+extension ValueTree.Change: CustomStringConvertible {
+  var description: String {
+    let bits = self.bits
+    let old = Self.description(of: self.old, bits: bits, name: self.oldName)
+    let new = Self.description(of: self.new, bits: bits, name: self.newName)
+    return "\(old) -> \(new)"
+  }
+
+  static func description(
+    of value: UInt64?,
+    bits: UInt64,
+    name: String?
+  ) -> String {
+    guard let value else { return "<missing>" }
+    guard let name else { return "\(hex: value, bits: bits)" }
+    return "\(hex: value, bits: bits) (\(name))"
+  }
+}
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// Registers sampled repeatedly by `svd watch`.
+///
+/// Key paths are resolved and reads are planned once when the watch is
+/// created, so taking a sample only performs the memory transactions of the
+/// plan. Samples are recorded in a ring buffer so they can be reviewed later.
+final class RegisterWatch {
+  struct Register {
+    var name: String
+    var address: UInt64
+    var bits: UInt64
+    /// Whether reading the register has side-effects, in which case it is
+    /// never coalesced with other reads.
+    var sideEffects: Bool
+    /// Whether the register is outside the address blocks of its peripheral,
+    /// in which case it is only watched if forced and never coalesced with
+    /// other reads.
+    var unmapped: Bool = false
+    /// The fields displayed when the value of the register changes.
+    var fields: [DecodeCommand.TableField]
+  }
+
+  struct Sample {
+    /// The number of samples taken by the watch before this one.
+    var number: Int
+    /// The value of each register, or `nil` if it could not be read.
+    var values: [UInt64?]
+  }
+
+  static let defaultCapacity = 1024
+
+  /// The arguments used to create the watch.
+  let keyPaths: [String]
+  let force: Bool
+  /// The watched registers, in address order.
+  let registers: [Register]
+  let plan: ReadPlan
+  private(set) var samples: RingBuffer<Sample>
+  private(set) var sampleCount: Int
+
+  init(
+    keyPaths: [String],
+    force: Bool,
+    registers: [Register],
+    barriers: [Range<UInt64>],
+    capacity: Int = RegisterWatch.defaultCapacity
+  ) {
+    self.keyPaths = keyPaths
+    self.force = force
+    self.registers = registers
+    self.plan = ReadPlan(
+      reads: registers.map {
+        .init(
+          address: $0.address,
+          bits: $0.bits,
+          coalescable: !$0.sideEffects && !$0.unmapped)
+      },
+      barriers: barriers,
+      options: .default)
+    self.samples = RingBuffer(capacity: capacity)
+    self.sampleCount = 0
+  }
+}
+
+extension RegisterWatch {
+  /// Reads the watched registers, records the values in the sample log, and
+  /// returns the new sample along with the previous sample, if any.
+  func sample(
+    debugger: inout some SVD2LLDBDebugger
+  ) -> (previous: Sample?, current: Sample) {
+    let previous = self.samples.last
+    let current = Sample(
+      number: self.sampleCount,
+      values: self.plan.execute(debugger: &debugger))
+    self.samples.append(current)
+    self.sampleCount += 1
+    return (previous, current)
+  }
+}
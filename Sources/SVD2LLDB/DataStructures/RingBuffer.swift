@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A fixed capacity buffer which discards its oldest elements to make room
+/// for new ones.
+struct RingBuffer<Element> {
+  private var storage: [Element]
+  /// The position in `storage` of the oldest element once the buffer is full.
+  private var head: Int
+  let capacity: Int
+
+  init(capacity: Int) {
+    precondition(capacity > 0, "Invalid ring buffer capacity \(capacity)")
+    self.storage = []
+    self.head = 0
+    self.capacity = capacity
+  }
+}
+
+extension RingBuffer {
+  /// Appends an element, discarding the oldest element if the buffer is full.
+  mutating func append(_ element: Element) {
+    if self.storage.count < self.capacity {
+      self.storage.append(element)
+    } else {
+      self.storage[self.head] = element
+      self.head = (self.head + 1) % self.capacity
+    }
+  }
+}
+
+extension RingBuffer: RandomAccessCollection {
+  var startIndex: Int { 0 }
+  var endIndex: Int { self.storage.count }
+
+  /// Accesses elements from oldest to newest.
+  subscript(position: Int) -> Element {
+    self.storage[(self.head + position) % self.storage.count]
+  }
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// The value of a register too wide to fit in a `UInt64`.
+///
+/// Crypto key slots and some DMA descriptors are described as single registers
+/// of 96 to 256 bits. Their values are read with a single bulk memory
+/// transaction and stored as little-endian 64-bit words, matching the byte
+/// order of the targets SVD2LLDB supports, so fields are sliced with shifts
+/// across at most two words.
+struct WideValue: Hashable {
+  /// The words of the value, least significant first.
+  var words: [UInt64]
+  var bits: UInt64
+}
+
+extension WideValue {
+  /// The number of 64-bit words holding a value of `bits` bits.
+  static func wordCount(bits: UInt64) -> Int {
+    Int(bits.roundUp(toMultipleOf: 64) / 64)
+  }
+
+  /// Creates a value from its little-endian bytes, ignoring bytes and bits
+  /// beyond `bits`.
+  init(bytes: some Collection<UInt8>, bits: UInt64) {
+    var words = [UInt64](repeating: 0, count: Self.wordCount(bits: bits))
+    for (index, byte) in bytes.prefix(words.count * 8).enumerated() {
+      words[index / 8] |= UInt64(byte) << ((index % 8) * 8)
+    }
+    self.init(words: words, bits: bits)
+    self.clearUnusedBits()
+  }
+
+  /// Parses a hexadecimal value such as "0x0123_4567_89ab_cdef_0123", or
+  /// returns `nil` if the string is not a hexadecimal value of at most `bits`
+  /// bits.
+  init?(parsing string: String, bits: UInt64) {
+    guard string.lowercased().hasPrefix("0x") else { return nil }
+    var words = [UInt64](repeating: 0, count: Self.wordCount(bits: bits))
+    var nibbles = 0
+    for character in string.dropFirst(2).reversed() where character != "_" {
+      guard let nibble = character.hexDigitValue else { return nil }
+      // Leading zeros never overflow the value.
+      if nibble != 0 {
+        let shift = UInt64(nibbles) * 4
+        guard shift < bits, UInt64(nibble) >> (bits - shift) == 0 else {
+          return nil
+        }
+        words[nibbles / 16] |= UInt64(nibble) << (shift % 64)
+      }
+      nibbles += 1
+    }
+    guard nibbles > 0 else { return nil }
+    self.init(words: words, bits: bits)
+  }
+
+  /// Zeroes the bits of the last word beyond `bits`.
+  private mutating func clearUnusedBits() {
+    let usedBits = self.bits % 64
+    guard usedBits != 0, let last = self.words.indices.last else { return }
+    self.words[last] &= (1 << usedBits) - 1
+  }
+
+  /// The number of bits held by the words of the value, which may exceed
+  /// `bits`. Bits beyond `bits` are always zero.
+  var capacity: UInt64 {
+    UInt64(self.words.count) * 64
+  }
+
+  /// Returns the bits of a field of at most 64 bits.
+  subscript(bits range: Range<UInt64>) -> UInt64 {
+    precondition(range.count <= 64 && range.upperBound <= self.capacity)
+    guard !range.isEmpty else { return 0 }
+    let word = Int(range.lowerBound / 64)
+    let shift = range.lowerBound % 64
+    var value = self.words[word] >> shift
+    // Take the high bits of the field from the next word if it straddles a
+    // word boundary.
+    if shift != 0, word + 1 < self.words.count {
+      value |= self.words[word + 1] << (64 - shift)
+    }
+    return value[bits: 0..<UInt64(range.count)]
+  }
+
+  /// Returns the bits of a field of any width as a value of its own.
+  func slice(bits range: Range<UInt64>) -> WideValue {
+    precondition(range.upperBound <= self.capacity)
+    let bits = UInt64(range.count)
+    var words = [UInt64](repeating: 0, count: Self.wordCount(bits: bits))
+    var lowerBound = range.lowerBound
+    for index in words.indices {
+      let upperBound = min(lowerBound + 64, range.upperBound)
+      words[index] = self[bits: lowerBound..<upperBound]
+      lowerBound = upperBound
+    }
+    return WideValue(words: words, bits: bits)
+  }
+}
+
+extension WideValue: CustomStringConvertible {
+  var description: String {
+    "\(hex: self.words, bits: self.bits)"
+  }
+}
@@ -11,6 +11,7 @@
 
 import ArgumentParser
 import CLLDB
+import Foundation
 
 extension Array where Element == String {
   init(_ arguments: lldb.SBCommandRawArguments?) {
@@ -32,7 +33,16 @@ extension lldb.SBCommand {
     self.AddCommand(
       Command.configuration.commandName,
       lldb.newSBCommand {
-        Command.run(
+        // Write progress directly to the debugger's output, which LLDB shows
+        // while the command is running.
+        if let outputFile = $0.pointee.GetOutputFileHandle() {
+          context.progressHandler = { message in
+            fputs("\(message)\n", outputFile)
+            fflush(outputFile)
+          }
+        }
+        defer { context.progressHandler = nil }
+        return Command.run(
           arguments: .init($1),
           debugger: &$0.pointee,
           result: &$2.pointee,
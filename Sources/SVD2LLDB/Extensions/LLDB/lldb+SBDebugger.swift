@@ -36,6 +36,26 @@ extension lldb.SBDebugger: SVD2LLDBDebugger {
     return value
   }
 
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    var error = lldb.SBError()
+    var target = self.GetSelectedTarget()
+    var process = target.GetProcess()
+    let bytes = [UInt8](unsafeUninitializedCapacity: count) { buffer, size in
+      size = process.ReadMemory(address, buffer.baseAddress, count, &error)
+    }
+    if bytes.count != count {
+      error.SetError(Self.lldbEIOError, lldb.eErrorTypePOSIX)
+      throw error
+    }
+    if error.IsValid() {
+      throw error
+    }
+    return bytes
+  }
+
   mutating func write(
     address: UInt64,
     value: UInt64,
@@ -56,4 +76,21 @@ extension lldb.SBDebugger: SVD2LLDBDebugger {
       throw error
     }
   }
+
+  mutating func stopID() -> UInt64? {
+    var target = self.GetSelectedTarget()
+    var process = target.GetProcess()
+    guard process.IsValid() else { return nil }
+    switch process.GetState() {
+    case lldb.eStateStopped, lldb.eStateCrashed, lldb.eStateSuspended:
+      // Include expression stops because running an expression may modify
+      // target memory. Mix in the unique id of the process because stop ids
+      // restart from zero when the process is relaunched.
+      let uniqueID = UInt64(process.GetUniqueID())
+      let stopID = UInt64(process.GetStopID(true))
+      return uniqueID << 32 | stopID
+    default:
+      return nil
+    }
+  }
 }
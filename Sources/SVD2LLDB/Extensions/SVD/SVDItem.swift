@@ -18,39 +18,20 @@ protocol SVDItem {
   var readAction: SVDReadAction? { get }
   var modifiedWriteValues: SVDModifiedWriteValues? { get }
   var registerProperties: SVDRegisterProperties { get }
+  var dimensionElement: SVDDimensionElement? { get }
 
-  // FIXME: This copies the entire subtree
-  func children() -> [any SVDItem]
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
   ) -> [(String, String)]
 }
 
-extension SVDItem {
-  func child(at key: some StringProtocol) -> (any SVDItem)? {
-    self.children().first { $0.name.matches(key) }
-  }
-
-  func child(at keyPath: ArraySlice<Substring>) -> (any SVDItem)? {
-    var keyPath = keyPath
-    var item: any SVDItem = self
-    while let key = keyPath.first {
-      defer { keyPath.removeFirst() }
-      guard let _item = item.child(at: key) else { return nil }
-      item = _item
-    }
-    return item
-  }
-}
-
 extension SVDDevice: SVDItem {
   var addressOffset: UInt64 { 0 }
+  var dimensionElement: SVDDimensionElement? { nil }
   var readAction: SVDReadAction? { nil }
   var modifiedWriteValues: SVD.SVDModifiedWriteValues? { nil }
 
-  func children() -> [any SVDItem] { self.peripherals.peripheral }
-
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
@@ -78,10 +59,6 @@ extension SVDPeripheral: SVDItem {
   var readAction: SVDReadAction? { nil }
   var modifiedWriteValues: SVD.SVDModifiedWriteValues? { nil }
 
-  func children() -> [any SVDItem] {
-    (self.registers?.cluster ?? []) + (self.registers?.register ?? [])
-  }
-
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
@@ -117,10 +94,6 @@ extension SVDCluster: SVDItem {
   var readAction: SVDReadAction? { nil }
   var modifiedWriteValues: SVD.SVDModifiedWriteValues? { nil }
 
-  func children() -> [any SVDItem] {
-    (self.cluster ?? []) + (self.register ?? [])
-  }
-
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
@@ -147,8 +120,6 @@ extension SVDCluster: SVDItem {
 extension SVDRegister: SVDItem {
   var field: [SVDField]? { self.fields?.field }
 
-  func children() -> [any SVDItem] { self.fields?.field ?? [] }
-
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
@@ -192,8 +163,6 @@ extension SVDField: SVDItem {
   var addressOffset: UInt64 { 0 }
   var registerProperties: SVDRegisterProperties { .none }
 
-  func children() -> [any SVDItem] { [] }
-
   func info(
     registerProperties: SVDRegisterProperties,
     address: UInt64
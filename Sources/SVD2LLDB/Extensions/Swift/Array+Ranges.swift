@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension Array where Element == Range<UInt64> {
+  /// Returns the ranges in ascending order with overlapping and adjacent
+  /// ranges combined and empty ranges removed.
+  func merged() -> Self {
+    var merged: Self = []
+    for range in self.sorted(by: { $0.lowerBound < $1.lowerBound })
+    where !range.isEmpty {
+      if let last = merged.last, range.lowerBound <= last.upperBound {
+        merged[merged.count - 1] =
+          last.lowerBound..<Swift.max(last.upperBound, range.upperBound)
+      } else {
+        merged.append(range)
+      }
+    }
+    return merged
+  }
+
+  /// Returns whether any of the ranges overlaps `range`, using a binary search
+  /// of ranges which have already been ``merged()``.
+  func mergedRangesOverlap(_ range: Range<UInt64>) -> Bool {
+    guard !range.isEmpty else { return false }
+    // Find the first range ending after the start of `range`.
+    var lowerBound = 0
+    var upperBound = self.count
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      if self[middle].upperBound <= range.lowerBound {
+        lowerBound = middle + 1
+      } else {
+        upperBound = middle
+      }
+    }
+    return lowerBound < self.count
+      && self[lowerBound].lowerBound < range.upperBound
+  }
+}
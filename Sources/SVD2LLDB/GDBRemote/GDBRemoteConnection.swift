@@ -0,0 +1,197 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A byte stream connected to a gdb-remote stub.
+protocol GDBRemoteTransport {
+  /// Sends bytes to the stub.
+  mutating func send(_ bytes: [UInt8]) throws
+  /// Blocks until bytes are received from the stub and returns them.
+  mutating func receive() throws -> [UInt8]
+}
+
+/// A client connection to a stub speaking the GDB remote serial protocol.
+///
+/// Once the stub accepts `QStartNoAckMode`, requests are pipelined: up to
+/// ``Options-swift.struct/maximumOutstandingPackets`` requests are sent before
+/// waiting for their responses, hiding the round trip latency of the
+/// connection. Stubs process requests in order, so responses are matched to
+/// requests by their position.
+///
+/// A transport or framing error leaves an unknown number of responses in
+/// flight which can no longer be matched to their requests, so the connection
+/// is marked as ``failed`` and every later request throws without accessing
+/// the transport.
+struct GDBRemoteConnection<Transport: GDBRemoteTransport> {
+  struct Options {
+    /// The largest number of requests sent before waiting for a response
+    /// once acknowledgements are disabled.
+    var maximumOutstandingPackets: Int
+    /// The largest packet, including framing, sent or requested even if the
+    /// stub supports larger packets.
+    var maximumPacketSize: Int
+  }
+
+  var transport: Transport
+  var options: Options
+  /// Whether packets are acknowledged, until the stub accepts
+  /// `QStartNoAckMode`.
+  private(set) var acknowledged: Bool
+  /// The largest packet the stub accepts, including framing.
+  private(set) var packetSize: Int
+  /// Whether an earlier exchange failed, leaving the connection unusable.
+  private(set) var failed: Bool
+  private var reader: GDBRemotePacketReader
+}
+
+extension GDBRemoteConnection.Options {
+  static var `default`: Self {
+    Self(maximumOutstandingPackets: 8, maximumPacketSize: 0x4000)
+  }
+}
+
+extension GDBRemoteConnection {
+  /// The packet size assumed if the stub does not report one.
+  static var defaultPacketSize: Int { 400 }
+
+  /// The number of times a packet is sent again after the stub rejects it.
+  static var maximumRetransmissions: Int { 3 }
+
+  /// Connects to a stub, negotiating the packet size and disabling
+  /// acknowledgements if the stub supports it.
+  init(transport: Transport, options: Options = .default) throws {
+    self.transport = transport
+    self.options = options
+    self.acknowledged = true
+    self.packetSize = min(Self.defaultPacketSize, options.maximumPacketSize)
+    self.failed = false
+    self.reader = GDBRemotePacketReader()
+
+    // Acknowledge any packet the stub sent before the connection was made.
+    try self.transport.send([GDBRemotePacket.ack])
+
+    var noAckMode = false
+    let features = try self.request(Array("qSupported".utf8))
+    for feature in features.split(separator: UInt8(ascii: ";")) {
+      let feature = String(decoding: feature, as: UTF8.self)
+      if feature == "QStartNoAckMode+" {
+        noAckMode = true
+      } else if feature.hasPrefix("PacketSize="),
+        let size = Int(feature.dropFirst("PacketSize=".count), radix: 16)
+      {
+        self.packetSize = min(size, options.maximumPacketSize)
+      }
+    }
+
+    if noAckMode,
+      try self.request(Array("QStartNoAckMode".utf8)) == Array("OK".utf8)
+    {
+      self.acknowledged = false
+    }
+  }
+
+  /// Sends a request and returns the response of the stub.
+  mutating func request(_ payload: [UInt8]) throws -> [UInt8] {
+    try self.exchange([payload])[0]
+  }
+
+  /// Sends requests and returns the responses of the stub, in order.
+  ///
+  /// Throws if the connection failed, or fails during the exchange.
+  mutating func exchange(_ requests: [[UInt8]]) throws -> [[UInt8]] {
+    guard !self.failed else {
+      throw GenericError("gdb-remote connection failed after an earlier error.")
+    }
+    do {
+      return try self.transfer(requests)
+    } catch {
+      self.failed = true
+      throw error
+    }
+  }
+
+  /// Sends requests, pipelining them if acknowledgements are disabled, and
+  /// returns the responses of the stub, in order.
+  private mutating func transfer(_ requests: [[UInt8]]) throws -> [[UInt8]] {
+    let window =
+      self.acknowledged ? 1 : max(self.options.maximumOutstandingPackets, 1)
+    var responses: [[UInt8]] = []
+    responses.reserveCapacity(requests.count)
+    var sent = 0
+    while responses.count < requests.count {
+      // Send as many requests as the window allows in a single write.
+      var packets: [UInt8] = []
+      while sent < requests.count, sent - responses.count < window {
+        packets.append(contentsOf: GDBRemotePacket.frame(requests[sent]))
+        sent += 1
+      }
+      if !packets.isEmpty {
+        try self.transport.send(packets)
+      }
+      if self.acknowledged {
+        try self.awaitAcknowledgement(of: requests[responses.count])
+      }
+      responses.append(try self.receivePacket())
+    }
+    return responses
+  }
+
+  /// Returns the next event received from the stub.
+  mutating func nextEvent() throws -> GDBRemotePacketReader.Event {
+    while true {
+      if let event = self.reader.next() {
+        return event
+      }
+      self.reader.append(try self.transport.receive())
+    }
+  }
+
+  /// Waits for the stub to acknowledge a request, sending it again if the
+  /// stub rejects it.
+  mutating func awaitAcknowledgement(of payload: [UInt8]) throws {
+    var retransmissions = 0
+    while true {
+      switch try self.nextEvent() {
+      case .ack:
+        return
+      case .nack:
+        guard retransmissions < Self.maximumRetransmissions else {
+          throw GenericError("gdb-remote stub rejected packet repeatedly.")
+        }
+        retransmissions += 1
+        try self.transport.send(GDBRemotePacket.frame(payload))
+      case .packet, .invalidPacket:
+        throw GenericError("gdb-remote stub responded without acknowledgement.")
+      }
+    }
+  }
+
+  /// Receives the next packet from the stub, acknowledging it if needed.
+  mutating func receivePacket() throws -> [UInt8] {
+    while true {
+      switch try self.nextEvent() {
+      case .ack, .nack:
+        // Stray acknowledgements carry no information once the request was
+        // acknowledged.
+        continue
+      case .packet(let payload):
+        if self.acknowledged {
+          try self.transport.send([GDBRemotePacket.ack])
+        }
+        return payload
+      case .invalidPacket:
+        guard self.acknowledged else {
+          throw GenericError("Received corrupt gdb-remote packet.")
+        }
+        try self.transport.send([GDBRemotePacket.nack])
+      }
+    }
+  }
+}
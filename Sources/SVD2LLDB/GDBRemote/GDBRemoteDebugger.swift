@@ -0,0 +1,213 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+
+/// A debugger which accesses target memory through a stub speaking the GDB
+/// remote serial protocol, such as OpenOCD, pyOCD, or a probe's firmware,
+/// without going through LLDB.
+///
+/// Memory is read with `m` packets and written with `X` packets, falling back
+/// to `M` packets if the stub does not support binary writes. Block reads
+/// larger than the negotiated packet size are split into multiple packets,
+/// and all packets of a batch of block reads are pipelined once the stub
+/// disables acknowledgements.
+struct GDBRemoteDebugger<Transport: GDBRemoteTransport> {
+  var connection: GDBRemoteConnection<Transport>
+  /// Whether the stub supports `X` packets, or `nil` before the first write.
+  var binaryWrites: Bool?
+  /// The identifier returned by ``stopID()``.
+  ///
+  /// The stub does not report when the target runs, so register values are
+  /// not cached unless the owner of the connection halts the target and sets
+  /// an identifier, changing it whenever the target resumes.
+  var currentStopID: UInt64?
+}
+
+extension GDBRemoteDebugger {
+  init(
+    transport: Transport,
+    options: GDBRemoteConnection<Transport>.Options = .default
+  ) throws {
+    self.connection = try GDBRemoteConnection(
+      transport: transport,
+      options: options)
+    self.binaryWrites = nil
+    self.currentStopID = nil
+  }
+
+  /// The largest number of bytes read by a single `m` packet, such that the
+  /// hexadecimal response and its framing fit in a packet.
+  var maximumReadSize: Int {
+    max((self.connection.packetSize - 4) / 2, 1)
+  }
+
+  /// Returns the `<address>,<length>` arguments of a memory packet.
+  static func arguments(address: UInt64, count: Int) -> [UInt8] {
+    Array("\(String(address, radix: 16)),\(String(count, radix: 16))".utf8)
+  }
+
+  /// Returns the bytes of an `m` packet response, or `nil` if the response
+  /// is an error.
+  ///
+  /// Stubs respond with `E` followed by an error number, such as `E01`, or
+  /// by `E.` and a message, and with an empty response if they do not support
+  /// the packet. Stubs which send uppercase hexadecimal bytes always send an
+  /// even number of digits, so they are never mistaken for an error number.
+  static func memory(_ response: [UInt8]) -> [UInt8]? {
+    guard !response.isEmpty else { return nil }
+    if response[0] == UInt8(ascii: "E"),
+      response.count == 3 || response.dropFirst().first == UInt8(ascii: ".")
+    {
+      return nil
+    }
+    return GDBRemotePacket.bytes(hex: response)
+  }
+
+  /// Reads blocks of memory, returning `nil` for each block which failed to
+  /// read.
+  ///
+  /// Every block is split into `m` packets of at most ``maximumReadSize``
+  /// bytes, which are sent together. Stubs may respond with fewer bytes than
+  /// requested, in which case the remaining bytes are requested again.
+  mutating func fetch(
+    blocks: [(address: UInt64, count: Int)]
+  ) throws -> [[UInt8]?] {
+    var results: [[UInt8]?] = blocks.map {
+      [UInt8](repeating: 0, count: $0.count)
+    }
+    var pending: [(block: Int, offset: Int, count: Int)] = []
+    for (index, block) in blocks.enumerated() {
+      var offset = 0
+      while offset < block.count {
+        let count = min(block.count - offset, self.maximumReadSize)
+        pending.append((index, offset, count))
+        offset += count
+      }
+    }
+
+    while !pending.isEmpty {
+      let requests = pending.map { chunk in
+        [UInt8(ascii: "m")]
+          + Self.arguments(
+            address: blocks[chunk.block].address + UInt64(chunk.offset),
+            count: chunk.count)
+      }
+      let responses = try self.connection.exchange(requests)
+      var remaining: [(block: Int, offset: Int, count: Int)] = []
+      for (chunk, response) in zip(pending, responses) {
+        guard
+          let bytes = Self.memory(response),
+          !bytes.isEmpty,
+          bytes.count <= chunk.count
+        else {
+          results[chunk.block] = nil
+          continue
+        }
+        let range = chunk.offset..<chunk.offset + bytes.count
+        results[chunk.block]?.replaceSubrange(range, with: bytes)
+        if bytes.count < chunk.count {
+          remaining.append(
+            (chunk.block, range.upperBound, chunk.count - bytes.count))
+        }
+      }
+      pending = remaining.filter { results[$0.block] != nil }
+    }
+    return results
+  }
+
+  /// Writes bytes to memory in a single packet.
+  mutating func write(address: UInt64, bytes: [UInt8]) throws {
+    let arguments = Self.arguments(address: address, count: bytes.count)
+    if self.binaryWrites != false {
+      let response = try self.connection.request(
+        [UInt8(ascii: "X")] + arguments + [UInt8(ascii: ":")]
+          + GDBRemotePacket.escaped(bytes))
+      // Stubs respond to unsupported packets with an empty response.
+      if !response.isEmpty {
+        self.binaryWrites = true
+        try Self.check(response, address: address)
+        return
+      }
+      self.binaryWrites = false
+    }
+    let response = try self.connection.request(
+      [UInt8(ascii: "M")] + arguments + [UInt8(ascii: ":")]
+        + GDBRemotePacket.hex(bytes))
+    try Self.check(response, address: address)
+  }
+
+  static func check(_ response: [UInt8], address: UInt64) throws {
+    guard response == Array("OK".utf8) else {
+      throw GenericError(
+        """
+        Failed to write memory at \(hex: address): \
+        \(String(decoding: response, as: UTF8.self)).
+        """)
+    }
+  }
+}
+
+extension GDBRemoteDebugger: SVD2LLDBDebugger {
+  mutating func read(
+    address: UInt64,
+    bits: some FixedWidthInteger
+  ) throws -> UInt64 {
+    let bits = UInt64(bits)
+    guard 0 < bits, bits <= 64 else {
+      throw GenericError("Invalid register size “\(bits)” bits.")
+    }
+    // The targets SVD2LLDB supports are little-endian.
+    let bytes = try self.read(
+      address: address,
+      count: Int(bits.roundUp(toMultipleOf: 8) / 8))
+    var value: UInt64 = 0
+    for (index, byte) in bytes.enumerated() {
+      value |= UInt64(byte) << (index * 8)
+    }
+    return bits < 64 ? value & ((1 << bits) &- 1) : value
+  }
+
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    guard let bytes = try self.fetch(blocks: [(address, count)])[0] else {
+      throw GenericError("Failed to read memory at \(hex: address).")
+    }
+    return bytes
+  }
+
+  mutating func read(
+    blocks: [(address: UInt64, count: Int)]
+  ) throws -> [[UInt8]?] {
+    try self.fetch(blocks: blocks)
+  }
+
+  mutating func write(
+    address: UInt64,
+    value: UInt64,
+    bits: some FixedWidthInteger
+  ) throws {
+    let bits = UInt64(bits)
+    guard 0 < bits, bits <= 64 else {
+      throw GenericError("Invalid register size “\(bits)” bits.")
+    }
+    let count = Int(bits.roundUp(toMultipleOf: 8) / 8)
+    try self.write(
+      address: address,
+      bytes: (0..<count).map { UInt8(truncatingIfNeeded: value >> ($0 * 8)) })
+  }
+
+  mutating func stopID() -> UInt64? {
+    self.currentStopID
+  }
+}
@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// Framing of packets of the GDB remote serial protocol.
+///
+/// Packets are sent as `$<payload>#<checksum>`, where the checksum is the sum
+/// of the payload bytes modulo 256 as two hexadecimal digits. The receiver of
+/// a packet acknowledges it with `+`, or requests it again with `-`, until
+/// acknowledgements are disabled with `QStartNoAckMode`.
+enum GDBRemotePacket {
+  static let start = UInt8(ascii: "$")
+  static let end = UInt8(ascii: "#")
+  static let notification = UInt8(ascii: "%")
+  static let escape = UInt8(ascii: "}")
+  static let runLength = UInt8(ascii: "*")
+  static let ack = UInt8(ascii: "+")
+  static let nack = UInt8(ascii: "-")
+
+  /// Returns the checksum of a payload.
+  static func checksum(_ payload: some Sequence<UInt8>) -> UInt8 {
+    payload.reduce(0, &+)
+  }
+
+  /// Returns the framed packet of a payload, ready to be sent.
+  static func frame(_ payload: [UInt8]) -> [UInt8] {
+    var packet = [UInt8]()
+    packet.reserveCapacity(payload.count + 4)
+    packet.append(Self.start)
+    packet.append(contentsOf: payload)
+    packet.append(Self.end)
+    packet.append(contentsOf: Self.hex([Self.checksum(payload)]))
+    return packet
+  }
+
+  /// Escapes binary data, such as the data of an `X` packet, so it never
+  /// contains bytes with a special meaning in packets.
+  static func escaped(_ bytes: [UInt8]) -> [UInt8] {
+    var escaped = [UInt8]()
+    escaped.reserveCapacity(bytes.count)
+    for byte in bytes {
+      switch byte {
+      case Self.start, Self.end, Self.escape, Self.runLength:
+        escaped.append(Self.escape)
+        escaped.append(byte ^ 0x20)
+      default:
+        escaped.append(byte)
+      }
+    }
+    return escaped
+  }
+
+  /// Expands the escaped bytes and run-length encoded sequences of a received
+  /// payload.
+  ///
+  /// A run-length encoded sequence `<byte>*<n>` repeats `<byte>` another
+  /// `n - 29` times, where `n` is the value of the character after the `*`.
+  static func decoded(_ payload: ArraySlice<UInt8>) -> [UInt8]? {
+    var decoded = [UInt8]()
+    decoded.reserveCapacity(payload.count)
+    var index = payload.startIndex
+    while index < payload.endIndex {
+      let byte = payload[index]
+      index += 1
+      switch byte {
+      case Self.escape:
+        guard index < payload.endIndex else { return nil }
+        decoded.append(payload[index] ^ 0x20)
+        index += 1
+      case Self.runLength:
+        guard
+          index < payload.endIndex,
+          let last = decoded.last,
+          payload[index] >= 29
+        else { return nil }
+        let count = Int(payload[index]) - 29
+        decoded.append(contentsOf: repeatElement(last, count: count))
+        index += 1
+      default:
+        decoded.append(byte)
+      }
+    }
+    return decoded
+  }
+
+  /// Returns the lowercase hexadecimal digits of `bytes`.
+  static func hex(_ bytes: some Sequence<UInt8>) -> [UInt8] {
+    let digits = Array("0123456789abcdef".utf8)
+    var hex = [UInt8]()
+    hex.reserveCapacity(bytes.underestimatedCount * 2)
+    for byte in bytes {
+      hex.append(digits[Int(byte >> 4)])
+      hex.append(digits[Int(byte & 0xf)])
+    }
+    return hex
+  }
+
+  /// Returns the bytes encoded by pairs of hexadecimal digits, or `nil` if
+  /// `hex` contains other characters or an odd number of digits.
+  static func bytes(hex: some Collection<UInt8>) -> [UInt8]? {
+    guard hex.count.isMultiple(of: 2) else { return nil }
+    var bytes = [UInt8]()
+    bytes.reserveCapacity(hex.count / 2)
+    var high: UInt8?
+    for character in hex {
+      guard let digit = Self.digit(character) else { return nil }
+      if let value = high {
+        bytes.append(value << 4 | digit)
+        high = nil
+      } else {
+        high = digit
+      }
+    }
+    return bytes
+  }
+
+  /// Returns the value of a hexadecimal digit.
+  static func digit(_ character: UInt8) -> UInt8? {
+    let (zero, lower, upper) =
+      (UInt8(ascii: "0"), UInt8(ascii: "a"), UInt8(ascii: "A"))
+    return switch character {
+    case zero...zero + 9: character - zero
+    case lower...lower + 5: character - lower + 10
+    case upper...upper + 5: character - upper + 10
+    default: nil
+    }
+  }
+}
+
+/// Splits the bytes received over a gdb-remote connection into
+/// acknowledgements and packets.
+struct GDBRemotePacketReader {
+  enum Event: Equatable {
+    case ack
+    case nack
+    /// A packet with its payload decoded.
+    case packet([UInt8])
+    /// A packet with an invalid checksum or encoding.
+    case invalidPacket
+  }
+
+  private var buffer: [UInt8] = []
+}
+
+extension GDBRemotePacketReader {
+  /// Adds received bytes to the reader.
+  mutating func append(_ bytes: [UInt8]) {
+    self.buffer.append(contentsOf: bytes)
+  }
+
+  /// Returns the next complete event, or `nil` if more bytes must be received
+  /// first.
+  ///
+  /// Bytes outside of packets and asynchronous notifications are skipped.
+  mutating func next() -> Event? {
+    while let first = self.buffer.first {
+      switch first {
+      case GDBRemotePacket.ack:
+        self.buffer.removeFirst()
+        return .ack
+      case GDBRemotePacket.nack:
+        self.buffer.removeFirst()
+        return .nack
+      case GDBRemotePacket.start, GDBRemotePacket.notification:
+        // Wait for the end of the packet and its two checksum digits.
+        guard
+          let end = self.buffer.firstIndex(of: GDBRemotePacket.end),
+          end + 2 < self.buffer.count
+        else { return nil }
+        let payload = self.buffer[1..<end]
+        let checksum = GDBRemotePacket.bytes(
+          hex: self.buffer[end + 1...end + 2])
+        let decoded = GDBRemotePacket.decoded(payload)
+        self.buffer.removeFirst(end + 3)
+        guard first == GDBRemotePacket.start else { continue }
+        guard
+          checksum == [GDBRemotePacket.checksum(payload)],
+          let decoded
+        else { return .invalidPacket }
+        return .packet(decoded)
+      default:
+        self.buffer.removeFirst()
+      }
+    }
+    return nil
+  }
+}
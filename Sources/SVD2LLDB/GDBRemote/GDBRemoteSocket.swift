@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+
+/// A TCP connection to a gdb-remote stub.
+final class GDBRemoteSocket {
+  let descriptor: Int32
+
+  /// Connects to the stub listening on `port` of `host`.
+  ///
+  /// Receiving fails if the stub does not respond within `timeout` seconds.
+  init(host: String, port: Int, timeout: Int = 5) throws {
+    var hints = addrinfo()
+    hints.ai_family = AF_UNSPEC
+    hints.ai_socktype = streamSocketType
+    var addresses: UnsafeMutablePointer<addrinfo>?
+    let status = getaddrinfo(host, String(port), &hints, &addresses)
+    guard status == 0, let addresses else {
+      throw GenericError(
+        """
+        Failed to resolve “\(host)”: \
+        \(String(cString: gai_strerror(status))).
+        """)
+    }
+    defer { freeaddrinfo(addresses) }
+
+    // Connect to the first address of the host which accepts a connection.
+    var descriptor: Int32 = -1
+    var error: Int32 = 0
+    var next: UnsafeMutablePointer<addrinfo>? = addresses
+    while let address = next, descriptor < 0 {
+      next = address.pointee.ai_next
+      let candidate = socket(
+        address.pointee.ai_family,
+        address.pointee.ai_socktype,
+        address.pointee.ai_protocol)
+      guard candidate >= 0 else {
+        error = errno
+        continue
+      }
+      guard
+        connect(candidate, address.pointee.ai_addr, address.pointee.ai_addrlen)
+          == 0
+      else {
+        error = errno
+        close(candidate)
+        continue
+      }
+      descriptor = candidate
+    }
+    guard descriptor >= 0 else {
+      throw GenericError(
+        """
+        Failed to connect to “\(host):\(port)”: \
+        \(String(cString: strerror(error))).
+        """)
+    }
+    self.descriptor = descriptor
+
+    // Packets are small and latency sensitive, send them immediately instead
+    // of coalescing them.
+    var enabled: Int32 = 1
+    setsockopt(
+      descriptor, Int32(IPPROTO_TCP), TCP_NODELAY, &enabled,
+      socklen_t(MemoryLayout<Int32>.size))
+    #if canImport(Darwin)
+    setsockopt(
+      descriptor, SOL_SOCKET, SO_NOSIGPIPE, &enabled,
+      socklen_t(MemoryLayout<Int32>.size))
+    #endif
+    var interval = timeval()
+    interval.tv_sec = timeout
+    setsockopt(
+      descriptor, SOL_SOCKET, SO_RCVTIMEO, &interval,
+      socklen_t(MemoryLayout<timeval>.size))
+  }
+
+  deinit {
+    close(self.descriptor)
+  }
+}
+
+extension GDBRemoteSocket: GDBRemoteTransport {
+  func send(_ bytes: [UInt8]) throws {
+    var sent = 0
+    while sent < bytes.count {
+      let count = bytes[sent...].withUnsafeBytes { buffer in
+        sendBytes(self.descriptor, buffer)
+      }
+      guard count > 0 else {
+        throw GenericError(
+          """
+          Failed to send to gdb-remote stub: \
+          \(String(cString: strerror(errno))).
+          """)
+      }
+      sent += count
+    }
+  }
+
+  func receive() throws -> [UInt8] {
+    var bytes = [UInt8](repeating: 0, count: 0x1000)
+    let count = bytes.withUnsafeMutableBytes { buffer in
+      receiveBytes(self.descriptor, buffer)
+    }
+    guard count > 0 else {
+      if count == 0 {
+        throw GenericError("gdb-remote stub closed the connection.")
+      }
+      throw GenericError(
+        """
+        Failed to receive from gdb-remote stub: \
+        \(String(cString: strerror(errno))).
+        """)
+    }
+    bytes.removeSubrange(count...)
+    return bytes
+  }
+}
+
+extension GDBRemoteDebugger where Transport == GDBRemoteSocket {
+  /// Connects to the stub listening on `port` of `host`.
+  init(host: String, port: Int) throws {
+    try self.init(transport: GDBRemoteSocket(host: host, port: port))
+  }
+}
+
+#if canImport(Glibc)
+private let streamSocketType = Int32(SOCK_STREAM.rawValue)
+#else
+private let streamSocketType = SOCK_STREAM
+#endif
+
+// Wrappers for the system calls shadowed by the transport's methods, which
+// never raise SIGPIPE if the stub closed the connection.
+private func sendBytes(
+  _ descriptor: Int32,
+  _ buffer: UnsafeRawBufferPointer
+) -> Int {
+  #if canImport(Darwin)
+  send(descriptor, buffer.baseAddress, buffer.count, 0)
+  #else
+  send(descriptor, buffer.baseAddress, buffer.count, Int32(MSG_NOSIGNAL))
+  #endif
+}
+
+private func receiveBytes(
+  _ descriptor: Int32,
+  _ buffer: UnsafeMutableRawBufferPointer
+) -> Int {
+  recv(descriptor, buffer.baseAddress, buffer.count, 0)
+}
@@ -0,0 +1,151 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import SVD
+
+/// Runs SVD2LLDB commands against memory images instead of a live target.
+///
+/// Commands may also run against a live target without LLDB, through a stub
+/// speaking the GDB remote serial protocol.
+///
+/// An inspector loads its SVD file once and may then run commands against
+/// many memory images concurrently, each image using its own command context.
+package final class OfflineInspector: @unchecked Sendable {
+  // The loaded device is never mutated after initialization, so sharing it
+  // across threads is safe.
+  let loadedDevice: DeviceLoad.LoadedDevice
+
+  /// The result of running a single command against a memory image.
+  package struct Report: Sendable {
+    package var command: [String]
+    package var success: Bool
+    package var output: String
+  }
+
+  init(device: SVDDevice) {
+    let deviceIndex = DeviceIndex(device: device)
+    self.loadedDevice = .init(
+      device: device,
+      deviceIndex: deviceIndex,
+      completionIndex: CompletionIndex(index: deviceIndex))
+  }
+
+  /// Loads the SVD file at `url`.
+  package init(contentsOf url: URL) throws {
+    switch DeviceLoad(url: url).wait() {
+    case .success(let loadedDevice):
+      self.loadedDevice = loadedDevice
+    case .failure(let error):
+      throw GenericError(
+        "Failed to load SVD file “\(url.lastPathComponent)”: \(error)")
+    }
+  }
+
+  /// Runs `commands` in order against `image`, returning a report for each.
+  ///
+  /// Each command is an argument list such as `["read", "TIMER0"]`; only the
+  /// commands which never modify target memory are available.
+  package func run(commands: [[String]], image: MemoryImage) -> [Report] {
+    var debugger = MemoryImage.Debugger(image: image)
+    return self.run(commands: commands, debugger: &debugger)
+  }
+
+  /// Runs `commands` in order against the memory of a live target, accessed
+  /// through the gdb-remote stub listening on `port` of `host`.
+  package func run(
+    commands: [[String]],
+    host: String,
+    port: Int
+  ) throws -> [Report] {
+    var debugger = try GDBRemoteDebugger(host: host, port: port)
+    return self.run(commands: commands, debugger: &debugger)
+  }
+
+  func run(
+    commands: [[String]],
+    debugger: inout some SVD2LLDBDebugger
+  ) -> [Report] {
+    let context = SVD2LLDB(device: nil)
+    let device = self.loadedDevice.device
+    context.add(
+      DeviceLoad(name: device.name, loadedDevice: self.loadedDevice),
+      namespace: device.name)
+
+    return commands.map { command in
+      var result = OfflineResult()
+      let arguments = Array(command.dropFirst())
+      let success =
+        switch command.first {
+        case "decode":
+          DecodeCommand.run(
+            arguments: arguments,
+            debugger: &debugger,
+            result: &result,
+            context: context)
+        case "info":
+          InfoCommand.run(
+            arguments: arguments,
+            debugger: &debugger,
+            result: &result,
+            context: context)
+        case "read":
+          ReadCommand.run(
+            arguments: arguments,
+            debugger: &debugger,
+            result: &result,
+            context: context)
+        default:
+          result.unknownCommand(command.first ?? "")
+        }
+      return Report(command: command, success: success, output: result.text)
+    }
+  }
+}
+
+/// Collects the output of a command run by an ``OfflineInspector``.
+struct OfflineResult {
+  var text = ""
+}
+
+extension OfflineResult {
+  mutating func append(_ string: String) {
+    if !self.text.isEmpty {
+      self.text.append("\n")
+    }
+    self.text.append(string)
+  }
+
+  mutating func unknownCommand(_ name: String) -> Bool {
+    self.error(
+      """
+      Unknown command “\(name)”. Use “decode”, “info”, or “read”.
+      """)
+    return false
+  }
+}
+
+extension OfflineResult: SVD2LLDBResult {
+  mutating func output(_ string: String) {
+    // Commands emit a lone newline to separate progress from results, which
+    // is already implied by appending a line.
+    guard string != "\n" else { return }
+    self.append(string)
+  }
+
+  mutating func warning(_ string: String) {
+    self.append("warning: \(string)")
+  }
+
+  mutating func error(_ string: String) {
+    self.append("error: \(string)")
+  }
+}
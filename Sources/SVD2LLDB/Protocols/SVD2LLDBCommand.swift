@@ -15,6 +15,8 @@ import SVD
 
 protocol SVD2LLDBCommand: ParsableCommand {
   static var autoRepeat: String { get }
+  /// Whether runs of the command are recorded for `svd stats`.
+  static var recordsStatistics: Bool { get }
 
   mutating func run(
     debugger: inout some SVD2LLDBDebugger,
@@ -24,16 +26,36 @@ protocol SVD2LLDBCommand: ParsableCommand {
 }
 
 extension SVD2LLDBCommand {
+  static var recordsStatistics: Bool { true }
+
   static func run(
     arguments: consuming [String],
     debugger: inout some SVD2LLDBDebugger,
     result: inout some SVD2LLDBResult,
     context: SVD2LLDB
   ) -> Bool {
+    // Record the time spent in each phase of the command and measure its
+    // memory transactions.
+    let statistics = context.statistics
+    if Self.recordsStatistics {
+      let name = Self.configuration.commandName ?? "\(Self.self)"
+      statistics.beginCommand(
+        (["svd", name] + copy arguments).joined(separator: " "))
+    }
+    var instrumented = InstrumentedDebugger(
+      base: debugger,
+      statistics: statistics)
+    defer {
+      debugger = instrumented.base
+      if Self.recordsStatistics {
+        statistics.endCommand()
+      }
+    }
+
     do {
       var command = try Self.parse(arguments)
       return try command.run(
-        debugger: &debugger,
+        debugger: &instrumented,
         result: &result,
         context: context)
     } catch {
@@ -10,14 +10,49 @@
 //===----------------------------------------------------------------------===//
 
 protocol SVD2LLDBDebugger {
-  // FIXME: Replace UInt64 with UInt128
+  /// Reads a register of at most 64 bits using its natural access width.
+  ///
+  /// Registers wider than 64 bits are read whole with
+  /// ``read(address:count:)`` instead.
   mutating func read(
     address: UInt64,
     bits: some FixedWidthInteger
   ) throws -> UInt64
+  /// Reads `count` contiguous bytes starting at `address` in a single memory
+  /// transaction.
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8]
+  /// Reads multiple blocks of contiguous bytes, returning `nil` for each
+  /// block which failed to read.
+  ///
+  /// Debuggers which can have multiple memory transactions in flight, such
+  /// as ``GDBRemoteDebugger``, issue every read before waiting for the
+  /// results. The default implementation reads the blocks one at a time.
+  ///
+  /// Throws if the debugger can no longer read memory at all, for example
+  /// after losing its connection to the target.
+  mutating func read(
+    blocks: [(address: UInt64, count: Int)]
+  ) throws -> [[UInt8]?]
   mutating func write(
     address: UInt64,
     value: UInt64,
     bits: some FixedWidthInteger
   ) throws
+  /// Returns an identifier for the current stop of the target process, or
+  /// `nil` if the process is not stopped.
+  ///
+  /// Target memory is assumed to be unchanged while the identifier is
+  /// unchanged.
+  mutating func stopID() -> UInt64?
+}
+
+extension SVD2LLDBDebugger {
+  mutating func read(
+    blocks: [(address: UInt64, count: Int)]
+  ) throws -> [[UInt8]?] {
+    blocks.map { try? self.read(address: $0.address, count: $0.count) }
+  }
 }
@@ -22,10 +22,37 @@ final class SVD2LLDB {
   /// execution.
   nonisolated(unsafe) static var shared: SVD2LLDB!
 
-  var device: SVDDevice?
+  /// The devices loaded by `svd load` keyed by namespace, including devices
+  /// still loading on a background thread.
+  var devices: [String: DeviceLoad] = [:] {
+    didSet { self.addressIndex = nil }
+  }
+  /// The namespace of the device used by key paths without a namespace.
+  var selectedNamespace: String?
+  /// The registers of all loaded devices by address, built on first use.
+  var addressIndex: AddressIndex?
+  /// Values of registers without side-effects read during the current stop of
+  /// the target process.
+  let registerValueCache: RegisterValueCache
+  /// The registers sampled by `svd watch`, if any.
+  var registerWatch: RegisterWatch?
+  /// Timings of the commands run in this session, reported by `svd stats`.
+  let statistics: CommandStatistics
+  /// Writes progress of the running command to the user immediately, if set.
+  ///
+  /// LLDB only shows the output of a command once it returns, so progress
+  /// reported while a command blocks, such as waiting for a background load,
+  /// is written directly to the debugger's output instead.
+  var progressHandler: ((String) -> Void)?
 
   init(device: SVDDevice?) {
-    self.device = device
+    self.registerValueCache = RegisterValueCache()
+    self.registerWatch = nil
+    self.statistics = CommandStatistics()
+    self.progressHandler = nil
+    if let device {
+      self.add(DeviceLoad(device: device), namespace: device.name)
+    }
   }
 }
 
@@ -35,11 +62,205 @@ extension SVD2LLDB {
     var interpreter = debugger.GetCommandInterpreter()
     var svdCommand = interpreter.AddMultiwordCommand(
       "svd", "Operate on registers by name.")
+    _ = svdCommand.add(CompleteCommand.self, context: self)
     _ = svdCommand.add(DecodeCommand.self, context: self)
+    _ = svdCommand.add(DiffCommand.self, context: self)
     _ = svdCommand.add(InfoCommand.self, context: self)
     _ = svdCommand.add(LoadCommand.self, context: self)
     _ = svdCommand.add(ReadCommand.self, context: self)
+    _ = svdCommand.add(SnapshotCommand.self, context: self)
+    _ = svdCommand.add(StatsCommand.self, context: self)
+    _ = svdCommand.add(WatchCommand.self, context: self)
     _ = svdCommand.add(WriteCommand.self, context: self)
+
+    // Start loading the SVD file named by the environment, if any, so it is
+    // likely ready by the time the user runs their first command.
+    let environment = ProcessInfo.processInfo.environment
+    if let path = environment[Self.preloadEnvironmentVariable] {
+      let url = URL(fileURLWithPath: path)
+      self.add(DeviceLoad(url: url), namespace: Self.namespace(of: url))
+    }
+  }
+}
+
+extension SVD2LLDB {
+  /// The name of the environment variable containing the path of an SVD file
+  /// to load when the plugin is initialized.
+  static let preloadEnvironmentVariable = "SVD2LLDB_SVD_FILE"
+
+  /// The separator between the namespace and the key path of an item, as in
+  /// "radio:RADIO.CTRL".
+  static let namespaceSeparator: Character = ":"
+
+  /// Returns the default namespace of the SVD file at `url`, its lowercased
+  /// name without extension.
+  static func namespace(of url: URL) -> String {
+    url.deletingPathExtension().lastPathComponent.lowercased()
+  }
+
+  /// Splits the namespace prefix, if any, from a key path.
+  static func splitNamespace(
+    _ keyPath: String
+  ) -> (namespace: String?, keyPath: String) {
+    guard let separator = keyPath.firstIndex(of: Self.namespaceSeparator)
+    else { return (nil, keyPath) }
+    let namespace = keyPath[..<separator].lowercased()
+    let rest = keyPath[keyPath.index(after: separator)...]
+    return (namespace, String(rest))
+  }
+
+  /// Adds a device to the loaded devices, replacing any device previously
+  /// loaded in the same namespace, and selects it.
+  func add(_ load: DeviceLoad, namespace: String) {
+    self.devices[namespace.lowercased()] = load
+    self.selectedNamespace = namespace.lowercased()
+  }
+
+  /// Returns the device loaded in `namespace`, or the selected device if
+  /// `namespace` is `nil`, blocking until a background load started by `svd
+  /// load` completes if needed.
+  func loadedDevice(
+    namespace: String? = nil,
+    result: inout some SVD2LLDBResult
+  ) throws -> DeviceLoad.LoadedDevice {
+    guard let namespace = namespace ?? self.selectedNamespace else {
+      throw NoSVDLoadedError()
+    }
+    guard let load = self.devices[namespace] else {
+      throw GenericError("No SVD file loaded in namespace “\(namespace)”.")
+    }
+    // Report progress if the command needs to wait for the load.
+    let phase = load.phase
+    if phase != .finished {
+      self.progress(
+        "Waiting for SVD file “\(load.name)” to load (\(phase.rawValue))...",
+        result: &result)
+    }
+    let outcome = self.statistics.measure(.loading) { load.wait() }
+    switch outcome {
+    case .success(let loaded):
+      return loaded
+    case .failure(let error):
+      // Forget the failed load so only the first command reports the error.
+      self.devices[namespace] = nil
+      if self.selectedNamespace == namespace {
+        self.selectedNamespace = nil
+      }
+      throw GenericError(
+        "Failed to load SVD file “\(load.name)”: \(error)")
+    }
+  }
+
+  /// Reports progress of the running command, immediately if a progress
+  /// handler is set and otherwise in the output of the command followed by a
+  /// blank line.
+  func progress(_ message: String, result: inout some SVD2LLDBResult) {
+    if let progressHandler = self.progressHandler {
+      progressHandler(message)
+    } else {
+      result.output(message)
+      result.output("\n")
+    }
+  }
+
+  /// Returns the index of the selected device, blocking until a background
+  /// load started by `svd load` completes if needed.
+  func loadedDeviceIndex(
+    result: inout some SVD2LLDBResult
+  ) throws -> DeviceIndex {
+    try self.loadedDevice(result: &result).deviceIndex
+  }
+
+  /// Returns the index of the device referred to by `keyPaths`, replacing
+  /// them with key paths into that device.
+  ///
+  /// A key path may start with the namespace of a loaded device followed by
+  /// ":" and otherwise refers to the selected device. A raw address, such as
+  /// "0x4000_1000", is dispatched to the device mapping it using the merged
+  /// address index and replaced by the key paths of the registers containing
+  /// it. If `unique` is true, an address must match a single register. All key
+  /// paths must refer to the same device.
+  func loadedDeviceIndex(
+    keyPaths: inout [String],
+    unique: Bool = false,
+    result: inout some SVD2LLDBResult
+  ) throws -> DeviceIndex {
+    let span = self.statistics.begin(.resolution)
+    defer { self.statistics.end(span) }
+    var namespace: String?
+    var resolvedKeyPaths: [String] = []
+    for argument in keyPaths {
+      let (argumentNamespace, argumentKeyPaths) = try self.resolve(
+        keyPath: argument, unique: unique, result: &result)
+      guard let resolvedNamespace = argumentNamespace ?? self.selectedNamespace
+      else { throw NoSVDLoadedError() }
+      if let namespace, namespace != resolvedNamespace {
+        throw GenericError(
+          """
+          Key paths refer to items in multiple namespaces “\(namespace)” and \
+          “\(resolvedNamespace)”.
+          """)
+      }
+      namespace = resolvedNamespace
+      resolvedKeyPaths.append(contentsOf: argumentKeyPaths)
+    }
+    keyPaths = resolvedKeyPaths
+    return try self.loadedDevice(namespace: namespace, result: &result)
+      .deviceIndex
+  }
+
+  /// Resolves the namespace prefix or raw address of a single key path.
+  func resolve(
+    keyPath: String,
+    unique: Bool,
+    result: inout some SVD2LLDBResult
+  ) throws -> (namespace: String?, keyPaths: [String]) {
+    guard
+      keyPath.lowercased().hasPrefix("0x"),
+      let address = SwiftIntegerParser<UInt64>().parseAll(keyPath)
+    else {
+      let (namespace, keyPath) = Self.splitNamespace(keyPath)
+      return (namespace, [keyPath])
+    }
+
+    // Prefer the selected device when multiple devices map the address, for
+    // example a peripheral shared by two cores, otherwise use the first.
+    let entries = try self.loadedAddressIndex(result: &result)
+      .entries(containing: address)
+    let namespace =
+      entries.contains { $0.namespace == self.selectedNamespace }
+      ? self.selectedNamespace : entries.first?.namespace
+    guard let namespace else {
+      // Leave unmapped addresses for the command to report as unknown.
+      return (nil, [keyPath])
+    }
+    let index = try self.loadedDevice(namespace: namespace, result: &result)
+      .deviceIndex
+    let keyPaths = entries.filter { $0.namespace == namespace }.map {
+      index.keyPath(of: $0.node)
+    }
+    if unique, keyPaths.count > 1 {
+      let names = keyPaths.map { "“\($0)”" }.joined(separator: ", ")
+      throw GenericError(
+        "Address “\(keyPath)” matches multiple registers: \(names).")
+    }
+    return (namespace, keyPaths)
+  }
+
+  /// Returns the merged address index of all loaded devices, blocking until
+  /// background loads complete if needed.
+  func loadedAddressIndex(
+    result: inout some SVD2LLDBResult
+  ) throws -> AddressIndex {
+    if let addressIndex = self.addressIndex { return addressIndex }
+    var devices: [(namespace: String, index: DeviceIndex)] = []
+    for namespace in self.devices.keys.sorted() {
+      let loaded = try self.loadedDevice(namespace: namespace, result: &result)
+      devices.append((namespace, loaded.deviceIndex))
+    }
+    let addressIndex = AddressIndex(devices: devices)
+    self.addressIndex = addressIndex
+    return addressIndex
   }
 }
 
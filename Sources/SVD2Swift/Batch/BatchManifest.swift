@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+
+/// A list of svd2swift jobs to run in a single process.
+///
+/// A manifest is a JSON object with a `jobs` array. Each job specifies an
+/// input SVD file, an output directory, and the same options accepted by the
+/// svd2swift command line and plugin configuration file:
+///
+/// ```json
+/// {
+///   "jobs": [
+///     {
+///       "input": "Devices/ExampleA.svd",
+///       "output": "Generated/ExampleA",
+///       "peripherals": ["UART0", "GPIOA"],
+///       "access-level": "public"
+///     }
+///   ]
+/// }
+/// ```
+///
+/// Relative paths are resolved against the directory containing the manifest.
+struct BatchManifest {
+  var jobs: [BatchJob]
+}
+
+extension BatchManifest: Decodable {}
+
+struct BatchJob {
+  var input: String
+  var output: String
+  var peripherals: [String]?
+  var accessLevel: AccessLevel?
+  var indentationWidth: Int?
+  var indentUsingTabs: Bool?
+  var namespaceUnderDevice: Bool?
+  var instanceMemberPeripherals: Bool?
+  var overrideDeviceName: String?
+  var relocatable: Bool?
+}
+
+extension BatchJob {
+  enum CodingKeys: String, CodingKey {
+    case input = "input"
+    case output = "output"
+    case peripherals = "peripherals"
+    case accessLevel = "access-level"
+    case indentationWidth = "indentation-width"
+    case indentUsingTabs = "indent-using-tabs"
+    case namespaceUnderDevice = "namespace-under-device"
+    case instanceMemberPeripherals = "instance-member-peripherals"
+    case overrideDeviceName = "device-name"
+    case relocatable = "relocatable"
+  }
+}
+
+extension BatchJob: Decodable {}
+
+extension BatchJob {
+  var exportOptions: ExportOptions {
+    let indentation =
+      if self.indentUsingTabs == true {
+        Indentation.tab
+      } else {
+        Indentation.space(self.indentationWidth ?? 4)
+      }
+    return ExportOptions(
+      indentation: indentation,
+      accessLevel: self.accessLevel,
+      selectedPeripherals: self.peripherals ?? [],
+      namespaceUnderDevice: self.namespaceUnderDevice ?? false,
+      instanceMemberPeripherals: self.instanceMemberPeripherals ?? false,
+      overrideDeviceName: self.overrideDeviceName,
+      relocatable: self.relocatable ?? false)
+  }
+}
+
+extension BatchManifest {
+  init(contentsOf path: String) throws {
+    let url = URL(fileURLWithPath: path)
+    try self.init(
+      data: try Data(contentsOf: url),
+      baseDirectory: url.deletingLastPathComponent())
+  }
+
+  init(data: Data, baseDirectory: URL) throws {
+    self = try JSONDecoder().decode(Self.self, from: data)
+    for index in self.jobs.indices {
+      try self.jobs[index].validate(index: index)
+      self.jobs[index].input = Self.resolve(
+        self.jobs[index].input,
+        relativeTo: baseDirectory)
+      self.jobs[index].output = Self.resolve(
+        self.jobs[index].output,
+        relativeTo: baseDirectory)
+    }
+  }
+
+  private static func resolve(
+    _ path: String,
+    relativeTo baseDirectory: URL
+  ) -> String {
+    guard !path.hasPrefix("/") else { return path }
+    return baseDirectory.appendingPathComponent(path).standardizedFileURL.path
+  }
+}
+
+extension BatchJob {
+  func validate(index: Int) throws {
+    if self.input == "-" || self.output == "-" {
+      throw SVD2SwiftError.invalidBatchJob(
+        index, "standard input and output cannot be used in batch mode")
+    }
+    if self.peripherals?.isEmpty == true {
+      throw SVD2SwiftError.invalidBatchJob(
+        index, "'peripherals' must not be empty when specified")
+    }
+    if self.namespaceUnderDevice != true,
+      self.instanceMemberPeripherals == true
+    {
+      throw SVD2SwiftError.invalidBatchJob(
+        index,
+        """
+        'instance-member-peripherals' can only be specified when using \
+        'namespace-under-device'
+        """)
+    }
+    if self.relocatable == true, self.instanceMemberPeripherals == true {
+      throw SVD2SwiftError.invalidBatchJob(
+        index,
+        """
+        'instance-member-peripherals' cannot be specified when using \
+        'relocatable'
+        """)
+    }
+  }
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+import SVD
+
+/// Runs the jobs of a ``BatchManifest`` on a bounded pool of threads.
+///
+/// Each distinct input SVD file is read, decoded, and inflated exactly once;
+/// all jobs naming that input share the resulting device. Failures are
+/// collected and reported together after every job has run.
+struct BatchRunner {
+  var manifest: BatchManifest
+  var maximumConcurrency: Int
+  var cache: DeviceCache?
+}
+
+extension BatchRunner {
+  func run() throws {
+    let jobs = self.manifest.jobs
+
+    // Decode each distinct input once.
+    let inputs = Array(Set(jobs.map(\.input))).sorted()
+    let cache = self.cache
+    let decodedDevices = Mutex<[String: Result<SVDDevice, any Error>]>([:])
+    concurrentForEach(
+      inputs,
+      maximumConcurrency: self.maximumConcurrency
+    ) { input in
+      let result = Result { () throws -> SVDDevice in
+        let data = try InputReader(input: .file(input)).read()
+        if let device = cache?.load(for: data) { return device }
+        var device = try SVDDevice(data: data)
+        try device.inflate()
+        cache?.store(device, for: data)
+        return device
+      }
+      decodedDevices.withLock { $0[input] = result }
+    }
+    let devices = decodedDevices.withLock { $0 }
+
+    // Export every job against its shared device.
+    let failures = Mutex<[Int: String]>([:])
+    concurrentForEach(
+      Array(jobs.enumerated()),
+      maximumConcurrency: self.maximumConcurrency
+    ) { index, job in
+      do {
+        guard let device = devices[job.input] else {
+          preconditionFailure("Missing decoded device for '\(job.input)'")
+        }
+        var output = Output.directory(job.output)
+        try device.get().export(with: job.exportOptions, to: &output)
+      } catch {
+        failures.withLock {
+          $0[index] = "job \(index) ('\(job.input)'): \(error)"
+        }
+      }
+    }
+
+    let failureDescriptions = failures.withLock { failures in
+      failures.keys.sorted().compactMap { failures[$0] }
+    }
+    guard failureDescriptions.isEmpty else {
+      throw SVD2SwiftError.batchJobsFailed(failureDescriptions, jobs.count)
+    }
+  }
+}
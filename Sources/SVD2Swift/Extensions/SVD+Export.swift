@@ -25,6 +25,7 @@ struct ExportOptions {
   var namespaceUnderDevice: Bool
   var instanceMemberPeripherals: Bool
   var overrideDeviceName: String?
+  var relocatable: Bool = false
 }
 
 struct ExportContext {
@@ -34,6 +35,9 @@ struct ExportContext {
   var swiftInstanceName: String
   var swiftParentTypeNames: [String]
   var registerProperties: SVDRegisterProperties
+  /// The address peripheral offsets are relative to when exporting a
+  /// relocatable device.
+  var relocationBase: UInt64?
 }
 
 extension ExportContext {
@@ -49,6 +53,7 @@ extension ExportContext {
     self.swiftInstanceName = ""
     self.swiftParentTypeNames = []
     self.registerProperties = .none
+    self.relocationBase = nil
   }
 
   func childContext(for exportable: any SVDExportable) -> Self {
@@ -66,7 +71,8 @@ extension ExportContext {
       swiftDescription: swiftDescription,
       swiftInstanceName: swiftInstanceName,
       swiftParentTypeNames: self.swiftParentTypeNames,
-      registerProperties: registerProperties)
+      registerProperties: registerProperties,
+      relocationBase: self.relocationBase)
   }
 
   func asParentContext() -> Self {
@@ -84,11 +90,13 @@ extension ExportContext {
 extension SVDDevice {
   func export(
     with options: ExportOptions,
-    to output: inout Output
+    to output: inout Output,
+    statistics: Statistics? = nil
   ) throws {
     var outputWriter = OutputWriter(
       output: output,
-      indentation: options.indentation)
+      indentation: options.indentation,
+      statistics: statistics)
     defer { output = outputWriter.output }
     try self.export(outputWriter: &outputWriter, options: options)
   }
@@ -237,8 +245,25 @@ extension SVDDevice: SVDExportable {
         "enum"
       }
 
+    // Relocatable devices are register blocks whose peripherals are at
+    // offsets from the lowest peripheral base address, so they can be placed
+    // at any address, such as the base of a memory mapping.
+    var context = context
+    if options.relocatable {
+      context.relocationBase =
+        outputPeripherals.lazy.map(\.baseAddress).min() ?? 0
+    }
+
     let scope =
-      if options.namespaceUnderDevice {
+      if let relocationBase = context.relocationBase {
+        """
+        \(comment: context.swiftDescription)
+        \(comment: "")
+        \(comment: "Peripherals are at offsets from \(hex: relocationBase).")
+        @RegisterBlock
+        \(options.accessLevel)struct \(context.swiftTypeName)
+        """
+      } else if options.namespaceUnderDevice {
         """
         \(comment: context.swiftDescription)
         \(options.accessLevel)\(deviceDeclarationType) \(context.swiftTypeName)
@@ -254,6 +279,13 @@ extension SVDDevice: SVDExportable {
           options: options,
           context: context.asParentContext().childContext(for: peripheral))
       }
+
+      for group in SVDPeripheralGroup.groups(in: outputPeripherals) {
+        group.exportAccessor(
+          outputWriter: &outputWriter,
+          options: options,
+          relocationBase: context.relocationBase)
+      }
     }
 
     return outputPeripherals
@@ -280,6 +312,8 @@ extension SVDPeripheral: SVDExportable {
     options: ExportOptions,
     context: ExportContext
   ) -> [any SVDExportable] {
+    outputWriter.statistics?.counts.peripherals += 1
+
     var exports: [any SVDExportable] = []
     if let derivedFrom = self.derivedFrom {
       // FIXME: Handle only exporting B where B deriveFrom A
@@ -325,6 +359,29 @@ extension SVDPeripheral: SVDExportable {
     options: ExportOptions,
     context: ExportContext
   ) {
+    if let relocationBase = context.relocationBase {
+      let offset = self.baseAddress - relocationBase
+      if let dimensionElement = self.dimensionElement {
+        let count = dimensionElement.dim
+        let stride = dimensionElement.dimIncrement
+
+        outputWriter.insert(
+          """
+          \(comment: context.swiftDescription)
+          @RegisterBlock(offset: \(hex: offset), stride: \(hex: stride), count: \(count))
+          \(options.accessLevel)var \(identifier: context.swiftInstanceName): RegisterArray<\(context.swiftTypeName)>
+          """)
+      } else {
+        outputWriter.insert(
+          """
+          \(comment: context.swiftDescription)
+          @RegisterBlock(offset: \(hex: offset))
+          \(options.accessLevel)var \(identifier: context.swiftInstanceName): \(context.swiftTypeName)
+          """)
+      }
+      return
+    }
+
     let accessorModifier =
       if options.namespaceUnderDevice && !options.instanceMemberPeripherals {
         "static "
@@ -352,6 +409,38 @@ extension SVDPeripheral: SVDExportable {
   }
 }
 
+extension SVDPeripheralGroup {
+  func exportAccessor(
+    outputWriter: inout OutputWriter,
+    options: ExportOptions,
+    relocationBase: UInt64?
+  ) {
+    if let relocationBase = relocationBase {
+      outputWriter.insert(
+        """
+        \(comment: "\(self.firstInstanceName) through \(self.lastInstanceName) indexed by instance number.")
+        @RegisterBlock(offset: \(hex: self.baseAddress - relocationBase), stride: \(hex: self.stride), count: \(self.count))
+        \(options.accessLevel)var \(identifier: self.name): RegisterArray<\(self.typeName)>
+        """)
+      return
+    }
+
+    let accessorModifier =
+      if options.namespaceUnderDevice && !options.instanceMemberPeripherals {
+        "static "
+      } else {
+        ""
+      }
+
+    outputWriter.insert(
+      """
+      \(comment: "\(self.firstInstanceName) through \(self.lastInstanceName) indexed by instance number.")
+      \(options.accessLevel)\(accessorModifier)let \(identifier: self.name) = RegisterArray<\(self.typeName)>(\
+      unsafeAddress: \(hex: self.baseAddress), stride: \(hex: self.stride), count: \(self.count))
+      """)
+  }
+}
+
 extension SVDCluster: SVDExportable {
   func swiftTypeName(context: ExportContext) -> String {
     self.name.removingUnsafeCharacters()
@@ -482,6 +571,7 @@ extension SVDRegister: SVDExportable {
         """)
       return []
     }
+    outputWriter.statistics?.counts.registers += 1
 
     var exports: [any SVDExportable] = []
 
@@ -567,6 +657,8 @@ extension SVDField: SVDExportable {
     options: ExportOptions,
     context: ExportContext
   ) {
+    outputWriter.statistics?.counts.fields += 1
+
     let macro =
       switch self.access ?? context.registerProperties.access {
       case .readOnly: "ReadOnly"
@@ -592,18 +684,12 @@ extension SVDField: SVDExportable {
       let count = dimensionElement.dim
       let stride = dimensionElement.dimIncrement
 
-      // FIXME: array fields
-      // Instead of splatting out N copies of the field we should have some way
-      // to describe an array like RegisterArray
-      for index in 0..<count {
-        let bitOffset = stride * index
-        outputWriter.insert(
-          """
-          \(comment: context.swiftDescription)
-          @\(macro)(bits: \(range.lowerBound + bitOffset)..<\(range.upperBound + bitOffset)\(_projection()))
-          \(options.accessLevel)var \(identifier: "\(context.swiftInstanceName)\(index)"): \(context.swiftTypeName)\(index)
-          """)
-      }
+      outputWriter.insert(
+        """
+        \(comment: context.swiftDescription)
+        @\(macro)(bits: \(range.lowerBound)..<\(range.upperBound), stride: \(stride), count: \(count)\(_projection()))
+        \(options.accessLevel)var \(identifier: context.swiftInstanceName): \(context.swiftTypeName)
+        """)
     } else {
       outputWriter.insert(
         """
@@ -636,6 +722,7 @@ extension SVDEnumeration: SVDExportable {
     options: ExportOptions,
     context: ExportContext
   ) -> [any SVDExportable] {
+    outputWriter.statistics?.counts.enumerations += 1
 
     let bitWidth = context.registerProperties.size ?? 0
     let rawValueWidth = max(8, bitWidth.roundedUpToPowerOfTwo())
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import SVD
+
+/// A set of peripheral instances sharing a type whose names differ only by a
+/// zero-based index suffix and whose base addresses are evenly spaced, for
+/// example `UART0` through `UART7`.
+///
+/// svd2swift exports each group as a `RegisterArray` in addition to the
+/// individual instances, allowing firmware to select an instance by index at
+/// runtime.
+struct SVDPeripheralGroup {
+  var name: String
+  var typeName: String
+  var firstInstanceName: String
+  var lastInstanceName: String
+  var baseAddress: UInt64
+  var stride: UInt64
+  var count: Int
+}
+
+extension SVDPeripheralGroup {
+  /// Returns the groups formed by `peripherals`, ordered by name.
+  static func groups(in peripherals: [SVDPeripheral]) -> [Self] {
+    let instanceNames = Set(
+      peripherals.map { $0.name.removingUnsafeCharacters().lowercased() })
+
+    // Bucket indexed instances by the type they share and their name prefix.
+    typealias Member = (index: Int, peripheral: SVDPeripheral)
+    var candidates: [String: (prefix: String, members: [Member])] = [:]
+    for peripheral in peripherals where peripheral.dimensionElement == nil {
+      let name = peripheral.name
+      guard
+        let prefixEnd = name.lastIndex(where: { !$0.isASCII || !$0.isNumber }),
+        let index = Int(name[name.index(after: prefixEnd)...])
+      else { continue }
+      let prefix = String(name[...prefixEnd])
+      let key = "\(peripheral.derivedFrom ?? name).\(prefix)"
+      candidates[key, default: (prefix, [])].members.append((index, peripheral))
+    }
+
+    var groups: [Self] = []
+    var groupNames: Set<String> = []
+    for key in candidates.keys.sorted() {
+      guard let candidate = candidates[key] else { continue }
+      let members = candidate.members.sorted { $0.index < $1.index }
+      guard
+        members.count > 1,
+        members.map(\.index) == Array(0..<members.count),
+        members[1].peripheral.baseAddress > members[0].peripheral.baseAddress
+      else { continue }
+
+      let first = members[0].peripheral
+      let stride = members[1].peripheral.baseAddress - first.baseAddress
+      let isEvenlySpaced = members.indices.allSatisfy { index in
+        members[index].peripheral.baseAddress
+          == first.baseAddress + UInt64(index) * stride
+      }
+      guard isEvenlySpaced else { continue }
+
+      let name = candidate.prefix
+        .removingUnsafeCharacters()
+        .trimmingCharacters(in: CharacterSet(charactersIn: "_"))
+        .lowercased()
+      guard
+        !name.isEmpty,
+        !instanceNames.contains(name),
+        groupNames.insert(name).inserted
+      else { continue }
+
+      groups.append(
+        .init(
+          name: name,
+          typeName: first.name.removingUnsafeCharacters(),
+          firstInstanceName: first.name,
+          lastInstanceName: members[members.count - 1].peripheral.name,
+          baseAddress: first.baseAddress,
+          stride: stride,
+          count: members.count))
+    }
+    return groups.sorted { $0.name < $1.name }
+  }
+}
@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import SVD
+
+/// A persistent, content-addressed cache of decoded and inflated devices.
+///
+/// Entries are keyed by the SHA-256 digest of the raw SVD data and of the
+/// svd2swift executable which decoded it, and stored as binary property
+/// lists, so a cache hit skips XML parsing, decoding, and inflation entirely.
+/// Because an entry is a pure function of the input bytes and the tool which
+/// produced it, generated output is identical whether or not the cache is
+/// used, and rebuilding svd2swift never reuses entries decoded by an older
+/// build. Unreadable, stale, or corrupt entries are treated as misses and
+/// failures to store an entry are ignored.
+struct DeviceCache {
+  /// The version of the on-disk entry format.
+  ///
+  /// Entries are also keyed by the executable which stored them, so this only
+  /// needs to change along with the layout of ``Entry``.
+  static let formatVersion = 3
+
+  struct Entry: Codable {
+    var formatVersion: Int
+    var key: String
+    var device: SVDDevice
+  }
+
+  var directory: String
+  /// The SHA-256 digest of the svd2swift executable, part of every key.
+  var toolDigest: String
+}
+
+extension DeviceCache {
+  /// Creates a cache of the devices decoded by the running executable, or
+  /// returns `nil` if the executable cannot be read to identify it.
+  init?(directory: String) {
+    guard let toolDigest = Self.executableDigest else { return nil }
+    self.init(directory: directory, toolDigest: toolDigest)
+  }
+
+  /// The SHA-256 digest of the running executable, computed once.
+  static let executableDigest: String? = {
+    guard
+      let url = Bundle.main.executableURL,
+      let data = try? Data(contentsOf: url, options: .mappedIfSafe)
+    else { return nil }
+    return SHA256.hexDigest(of: data)
+  }()
+
+  /// Returns the cache key for raw SVD `data`.
+  func key(for data: Data) -> String {
+    SHA256.hexDigest(of: Array("\(self.toolDigest)\n".utf8) + data)
+  }
+
+  func entryURL(key: String) -> URL {
+    URL(fileURLWithPath: self.directory)
+      .appendingPathComponent("\(key).svdcache")
+  }
+
+  /// Loads the cached device for raw SVD `data`, if present and valid.
+  func load(for data: Data) -> SVDDevice? {
+    let key = self.key(for: data)
+    guard
+      let entryData = try? Data(contentsOf: self.entryURL(key: key)),
+      let entry = try? PropertyListDecoder()
+        .decode(Entry.self, from: entryData),
+      entry.formatVersion == Self.formatVersion,
+      entry.key == key
+    else { return nil }
+    return entry.device
+  }
+
+  /// Stores `device`, decoded and inflated from raw SVD `data`.
+  func store(_ device: SVDDevice, for data: Data) {
+    let key = self.key(for: data)
+    let entry = Entry(
+      formatVersion: Self.formatVersion,
+      key: key,
+      device: device)
+    let encoder = PropertyListEncoder()
+    encoder.outputFormat = .binary
+    guard let entryData = try? encoder.encode(entry) else { return }
+    try? FileManager.default.createDirectory(
+      at: URL(fileURLWithPath: self.directory),
+      withIntermediateDirectories: true)
+    // Write atomically so concurrent invocations never observe a partially
+    // written entry.
+    try? entryData.write(to: self.entryURL(key: key), options: .atomic)
+  }
+}
@@ -50,15 +50,21 @@ struct OutputWriter {
   var indentationLevel: Int
   var fileContent: String
   var scopes: [Scope]
+  var statistics: Statistics?
 }
 
 extension OutputWriter {
-  init(output: Output, indentation: Indentation) {
+  init(
+    output: Output,
+    indentation: Indentation,
+    statistics: Statistics? = nil
+  ) {
     self.output = output
     self.indentation = indentation
     self.indentationLevel = 0
     self.fileContent = ""
     self.scopes = [.root]
+    self.statistics = statistics
   }
 }
 
@@ -175,6 +181,18 @@ extension OutputWriter {
     precondition(
       self.indentationLevel == 0,
       "Failed to fully unwind indentation, currently: \(self.indentationLevel)")
+    if let statistics = self.statistics {
+      statistics.filesGenerated += 1
+      statistics.bytesGenerated += self.fileContent.utf8.count
+      try statistics.measure(.flush) { try self.writeFileContent(to: path) }
+    } else {
+      try self.writeFileContent(to: path)
+    }
+    self.fileContent = ""
+    self.scopes = [.root]
+  }
+
+  private mutating func writeFileContent(to path: String) throws {
     switch self.output {
     case .standardOutput:
       print(self.fileContent, terminator: "")
@@ -191,7 +209,5 @@ extension OutputWriter {
       dictionary[path] = fileContent
       self.output = .inMemory(dictionary)
     }
-    self.fileContent = ""
-    self.scopes = [.root]
   }
 }
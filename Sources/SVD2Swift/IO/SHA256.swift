@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if canImport(CryptoKit)
+import CryptoKit
+#endif
+
+/// The SHA-256 hash function (FIPS 180-4), used to key the device cache.
+///
+/// Uses CryptoKit where it is available. Other platforms, such as Linux, have
+/// no cryptography library in the toolchain, and depending on swift-crypto
+/// would add a package dependency to every client of swift-mmio for a single
+/// digest of trusted, local build inputs, so they use the minimal
+/// implementation below, which is checked against the FIPS 180-4 test
+/// vectors.
+struct SHA256 {
+  /// Returns the lowercase hexadecimal SHA-256 digest of `bytes`.
+  static func hexDigest<Bytes>(
+    of bytes: Bytes
+  ) -> String where Bytes: Collection, Bytes.Element == UInt8 {
+    #if canImport(CryptoKit)
+    var digest = ""
+    for byte in CryptoKit.SHA256.hash(data: Array(bytes)) {
+      let hex = String(byte, radix: 16)
+      digest += hex.count == 1 ? "0" + hex : hex
+    }
+    return digest
+    #else
+    return Self.portableHexDigest(of: bytes)
+    #endif
+  }
+}
+
+#if !canImport(CryptoKit)
+extension SHA256 {
+  private static let roundConstants: [UInt32] = [
+    0x428a_2f98, 0x7137_4491, 0xb5c0_fbcf, 0xe9b5_dba5, 0x3956_c25b,
+    0x59f1_11f1, 0x923f_82a4, 0xab1c_5ed5, 0xd807_aa98, 0x1283_5b01,
+    0x2431_85be, 0x550c_7dc3, 0x72be_5d74, 0x80de_b1fe, 0x9bdc_06a7,
+    0xc19b_f174, 0xe49b_69c1, 0xefbe_4786, 0x0fc1_9dc6, 0x240c_a1cc,
+    0x2de9_2c6f, 0x4a74_84aa, 0x5cb0_a9dc, 0x76f9_88da, 0x983e_5152,
+    0xa831_c66d, 0xb003_27c8, 0xbf59_7fc7, 0xc6e0_0bf3, 0xd5a7_9147,
+    0x06ca_6351, 0x1429_2967, 0x27b7_0a85, 0x2e1b_2138, 0x4d2c_6dfc,
+    0x5338_0d13, 0x650a_7354, 0x766a_0abb, 0x81c2_c92e, 0x9272_2c85,
+    0xa2bf_e8a1, 0xa81a_664b, 0xc24b_8b70, 0xc76c_51a3, 0xd192_e819,
+    0xd699_0624, 0xf40e_3585, 0x106a_a070, 0x19a4_c116, 0x1e37_6c08,
+    0x2748_774c, 0x34b0_bcb5, 0x391c_0cb3, 0x4ed8_aa4a, 0x5b9c_ca4f,
+    0x682e_6ff3, 0x748f_82ee, 0x78a5_636f, 0x84c8_7814, 0x8cc7_0208,
+    0x90be_fffa, 0xa450_6ceb, 0xbef9_a3f7, 0xc671_78f2,
+  ]
+
+  private static let initialState: [UInt32] = [
+    0x6a09_e667, 0xbb67_ae85, 0x3c6e_f372, 0xa54f_f53a, 0x510e_527f,
+    0x9b05_688c, 0x1f83_d9ab, 0x5be0_cd19,
+  ]
+
+  static func portableHexDigest<Bytes>(
+    of bytes: Bytes
+  ) -> String where Bytes: Collection, Bytes.Element == UInt8 {
+    var state = Self.initialState
+    var message = Array(bytes)
+    let bitCount = UInt64(message.count) &* 8
+    message.append(0x80)
+    while message.count % 64 != 56 {
+      message.append(0)
+    }
+    for shift in stride(from: 56, through: 0, by: -8) {
+      message.append(UInt8(truncatingIfNeeded: bitCount >> UInt64(shift)))
+    }
+    for start in stride(from: 0, to: message.count, by: 64) {
+      Self.compress(message[start..<start + 64], into: &state)
+    }
+
+    var digest = ""
+    for word in state {
+      let hex = String(word, radix: 16)
+      digest += String(repeating: "0", count: 8 - hex.count) + hex
+    }
+    return digest
+  }
+
+  private static func compress(
+    _ block: ArraySlice<UInt8>,
+    into state: inout [UInt32]
+  ) {
+    var w = [UInt32](repeating: 0, count: 64)
+    var index = block.startIndex
+    for t in 0..<16 {
+      for _ in 0..<4 {
+        w[t] = w[t] << 8 | UInt32(block[index])
+        index += 1
+      }
+    }
+    for t in 16..<64 {
+      let s0 = w[t - 15].rotatedRight(7) ^ w[t - 15].rotatedRight(18)
+        ^ (w[t - 15] >> 3)
+      let s1 = w[t - 2].rotatedRight(17) ^ w[t - 2].rotatedRight(19)
+        ^ (w[t - 2] >> 10)
+      w[t] = w[t - 16] &+ s0 &+ w[t - 7] &+ s1
+    }
+
+    var a = state[0]
+    var b = state[1]
+    var c = state[2]
+    var d = state[3]
+    var e = state[4]
+    var f = state[5]
+    var g = state[6]
+    var h = state[7]
+    for t in 0..<64 {
+      let s1 = e.rotatedRight(6) ^ e.rotatedRight(11) ^ e.rotatedRight(25)
+      let choice = (e & f) ^ (~e & g)
+      let t1 = h &+ s1 &+ choice &+ Self.roundConstants[t] &+ w[t]
+      let s0 = a.rotatedRight(2) ^ a.rotatedRight(13) ^ a.rotatedRight(22)
+      let majority = (a & b) ^ (a & c) ^ (b & c)
+      let t2 = s0 &+ majority
+      h = g
+      g = f
+      f = e
+      e = d &+ t1
+      d = c
+      c = b
+      b = a
+      a = t1 &+ t2
+    }
+    state[0] &+= a
+    state[1] &+= b
+    state[2] &+= c
+    state[3] &+= d
+    state[4] &+= e
+    state[5] &+= f
+    state[6] &+= g
+    state[7] &+= h
+  }
+}
+
+extension UInt32 {
+  fileprivate func rotatedRight(_ count: UInt32) -> UInt32 {
+    (self >> count) | (self << (32 - count))
+  }
+}
+#endif
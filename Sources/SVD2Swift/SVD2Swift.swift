@@ -28,13 +28,13 @@ struct SVD2Swift: ParsableCommand {
     name: [.short, .customLong("input")],
     help: "Specify the input SVD file. Use '-' for stdin.",
     completion: .file(extensions: ["svd"]))
-  var inputSVDFile: String
+  var inputSVDFile: String?
 
   @Option(
     name: [.short, .customLong("output")],
     help: "Specify the output directory. Use '-' for stdout.",
     completion: .directory)
-  var outputDirectory: String
+  var outputDirectory: String?
 
   @Option(
     name: [.customShort("p"), .customLong("peripherals")],
@@ -98,21 +98,73 @@ struct SVD2Swift: ParsableCommand {
       """)
   var overrideDeviceName: String?
 
-  func inputReader() -> InputReader {
+  @Flag(
+    name: .long,
+    help:
+      """
+      Specify the device type should be a register block with peripherals at \
+      offsets from the lowest peripheral base address, so it can be placed at \
+      any address such as the base of a memory mapping.
+      """)
+  var relocatable: Bool = false
+
+  @Option(
+    name: .customLong("stats"),
+    help:
+      """
+      Print per-phase wall time and peak memory, declaration counts, and the \
+      number of bytes generated to stderr in the specified format.
+      """)
+  var statisticsFormat: StatisticsFormat?
+
+  @Option(
+    name: .customLong("batch"),
+    help:
+      """
+      Specify a JSON manifest of jobs to run in a single process. Each job \
+      names an input SVD file, an output directory, and generation options. \
+      This option cannot be combined with '--input', '--output', or other \
+      generation options.
+      """,
+    completion: .file(extensions: ["json"]))
+  var batchManifestFile: String?
+
+  @Option(
+    name: [.short, .long],
+    help:
+      """
+      Specify the maximum number of batch jobs to run concurrently. This \
+      option is only applicable when '--batch' is used. Skipping this option \
+      uses the number of active processors.
+      """)
+  var jobs: Int?
+
+  @Option(
+    name: .long,
+    help:
+      """
+      Specify a directory in which to cache decoded devices. Subsequent runs \
+      with identical input SVD data load the cached device instead of \
+      parsing the input.
+      """,
+    completion: .directory)
+  var cacheDirectory: String?
+
+  func inputReader(_ inputSVDFile: String) -> InputReader {
     let input =
-      if self.inputSVDFile == "-" {
+      if inputSVDFile == "-" {
         Input.standardInput
       } else {
-        Input.file(self.inputSVDFile)
+        Input.file(inputSVDFile)
       }
     return InputReader(input: input)
   }
 
-  func output() -> Output {
-    if self.outputDirectory == "-" {
+  func output(_ outputDirectory: String) -> Output {
+    if outputDirectory == "-" {
       Output.standardOutput
     } else {
-      Output.directory(self.outputDirectory)
+      Output.directory(outputDirectory)
     }
   }
 
@@ -125,6 +177,51 @@ struct SVD2Swift: ParsableCommand {
   }
 
   func validate() throws {
+    if let jobs = self.jobs, jobs < 1 {
+      throw ValidationError(
+        "Invalid value '\(jobs)' for '--jobs', expected a positive integer.")
+    }
+
+    if self.batchManifestFile != nil {
+      let conflictingOptions = [
+        ("--input", self.inputSVDFile != nil),
+        ("--output", self.outputDirectory != nil),
+        ("--peripherals", !self.selectedPeripherals.isEmpty),
+        ("--access-level", self.accessLevel != nil),
+        ("--indent-using-tabs", self.indentUsingTabs),
+        ("--namespace-under-device", self.namespaceUnderDevice),
+        ("--instance-member-peripherals", self.instanceMemberPeripherals),
+        ("--device-name", self.overrideDeviceName != nil),
+        ("--relocatable", self.relocatable),
+        ("--stats", self.statisticsFormat != nil),
+        ("--plugin", self.ranViaSwiftPackagePlugin),
+      ]
+      for (option, isSpecified) in conflictingOptions where isSpecified {
+        throw ValidationError(
+          """
+          Unexpected argument, '\(option)' cannot be specified when using \
+          '--batch'. Specify generation options per job in the manifest.
+          """)
+      }
+      return
+    }
+
+    if self.jobs != nil {
+      throw ValidationError(
+        """
+        Unexpected argument, '--jobs' can only be specified when using \
+        '--batch'.
+        """)
+    }
+
+    if self.inputSVDFile == nil {
+      throw ValidationError("Missing expected argument '--input <input>'.")
+    }
+
+    if self.outputDirectory == nil {
+      throw ValidationError("Missing expected argument '--output <output>'.")
+    }
+
     if self.selectedPeripherals.isEmpty && self.ranViaSwiftPackagePlugin {
       throw ValidationError(
         """
@@ -141,29 +238,84 @@ struct SVD2Swift: ParsableCommand {
         specified when using '--namespace-under-device'.
         """)
     }
+
+    if self.relocatable, self.instanceMemberPeripherals {
+      throw ValidationError(
+        """
+        Unexpected argument, '--instance-member-peripherals' cannot be \
+        specified when using '--relocatable'.
+        """)
+    }
   }
 
   func run() throws {
+    if let batchManifestFile = self.batchManifestFile {
+      try self.runBatch(manifestFile: batchManifestFile)
+    } else {
+      try self.runSingle()
+    }
+  }
+
+  func runBatch(manifestFile: String) throws {
+    let runner = BatchRunner(
+      manifest: try BatchManifest(contentsOf: manifestFile),
+      maximumConcurrency: self.jobs
+        ?? ProcessInfo.processInfo.activeProcessorCount,
+      cache: self.cacheDirectory.flatMap(DeviceCache.init(directory:)))
+    try runner.run()
+  }
+
+  func runSingle() throws {
+    guard let inputSVDFile = self.inputSVDFile,
+      let outputDirectory = self.outputDirectory
+    else { preconditionFailure("Unvalidated command line arguments") }
+
+    let statistics = Statistics()
+
     // Load input file from disk.
-    let data = try self.inputReader().read()
+    statistics.begin(.read)
+    let data = try self.inputReader(inputSVDFile).read()
 
-    // Decode raw data into SVD types.
-    var device = try SVDDevice(data: data)
+    // Load the decoded device from the cache if possible.
+    let cache = self.cacheDirectory.flatMap(DeviceCache.init(directory:))
+    statistics.begin(.cache)
+    var device: SVDDevice
+    if let cachedDevice = cache?.load(for: data) {
+      device = cachedDevice
+    } else {
+      // Decode raw data into SVD types.
+      statistics.begin(.xml)
+      device = try SVDDevice(data: data) { statistics.begin(.decode) }
 
-    // Inflate the decoded device.
-    try device.inflate()
+      // Inflate the decoded device.
+      statistics.begin(.inflate)
+      try device.inflate()
+
+      // Save the inflated device for subsequent runs.
+      statistics.begin(.cache)
+      cache?.store(device, for: data)
+    }
 
     // Create export options and an output destination.
+    statistics.begin(.export)
     let options = ExportOptions(
       indentation: self.indentation(),
       accessLevel: self.accessLevel,
       selectedPeripherals: self.selectedPeripherals,
       namespaceUnderDevice: self.namespaceUnderDevice,
       instanceMemberPeripherals: self.instanceMemberPeripherals,
-      overrideDeviceName: self.overrideDeviceName)
-    var output = self.output()
+      overrideDeviceName: self.overrideDeviceName,
+      relocatable: self.relocatable)
+    var output = self.output(outputDirectory)
 
     // Export the swift interface into the output directory.
-    try device.export(with: options, to: &output)
+    try device.export(with: options, to: &output, statistics: statistics)
+    statistics.end()
+
+    // Report statistics if requested.
+    if let statisticsFormat = self.statisticsFormat {
+      let report = statistics.report(format: statisticsFormat)
+      FileHandle.standardError.write(Data(report.utf8))
+    }
   }
 }
@@ -13,6 +13,8 @@ import MMIOUtilities
 
 enum SVD2SwiftError: Error {
   case unknownPeripheral(String, [String])
+  case invalidBatchJob(Int, String)
+  case batchJobsFailed([String], Int)
 }
 
 extension SVD2SwiftError: CustomStringConvertible {
@@ -20,6 +22,13 @@ extension SVD2SwiftError: CustomStringConvertible {
     switch self {
     case .unknownPeripheral(let peripheral, let peripherals):
       "Unknown peripheral '\(peripheral)', valid options: \(list: peripherals)."
+    case .invalidBatchJob(let index, let reason):
+      "Invalid job \(index) in batch manifest: \(reason)."
+    case .batchJobsFailed(let failures, let jobCount):
+      """
+      \(failures.count) of \(jobCount) batch jobs failed:
+      \(failures.map { "  - \($0)" }.joined(separator: "\n"))
+      """
     }
   }
 }
@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Dispatch
+import Foundation
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+
+/// Collects timing, memory, and output statistics for a single run of
+/// svd2swift.
+///
+/// Phases are tracked with a single running clock: beginning a phase ends the
+/// previous one, and ``measure(_:body:)`` temporarily switches to a nested
+/// phase before resuming the enclosing one. This allows phases which are
+/// interleaved with each other, such as export and flush, to be reported
+/// separately.
+final class Statistics {
+  enum Phase: String, CaseIterable {
+    /// Loading the input SVD file.
+    case read
+    /// Loading or storing a cached decoded device.
+    case cache
+    /// Tokenizing the input and building an XML element tree.
+    case xml
+    /// Decoding the XML element tree into SVD types.
+    case decode
+    /// Resolving `derivedFrom` references and inheriting properties.
+    case inflate
+    /// Generating Swift source text.
+    case export
+    /// Writing generated source text to the output.
+    case flush
+  }
+
+  struct PhaseMeasurement {
+    /// The total wall time spent in the phase, in nanoseconds.
+    var wallTime: UInt64 = 0
+    /// The peak resident memory of the process observed at the end of the
+    /// phase, in bytes.
+    var peakMemory: Int = 0
+  }
+
+  /// The number of declarations generated by the export, dimensioned
+  /// declarations are counted once.
+  struct Counts {
+    var peripherals = 0
+    var registers = 0
+    var fields = 0
+    var enumerations = 0
+  }
+
+  private(set) var phases: [Phase: PhaseMeasurement] = [:]
+  var counts = Counts()
+  var filesGenerated = 0
+  var bytesGenerated = 0
+
+  private var currentPhase: Phase?
+  private var currentPhaseStart: UInt64 = 0
+
+  /// Ends the current phase, if any, and begins timing `phase`.
+  func begin(_ phase: Phase) {
+    self.end()
+    self.currentPhase = phase
+    self.currentPhaseStart = DispatchTime.now().uptimeNanoseconds
+  }
+
+  /// Ends the current phase, if any.
+  func end() {
+    guard let phase = self.currentPhase else { return }
+    let elapsed = DispatchTime.now().uptimeNanoseconds - self.currentPhaseStart
+    var measurement = self.phases[phase, default: .init()]
+    measurement.wallTime += elapsed
+    measurement.peakMemory = max(measurement.peakMemory, peakResidentMemory())
+    self.phases[phase] = measurement
+    self.currentPhase = nil
+  }
+
+  /// Times `body` as `phase`, then resumes the enclosing phase, if any.
+  func measure<T, E>(
+    _ phase: Phase,
+    body: () throws(E) -> T
+  ) throws(E) -> T where E: Error {
+    let enclosingPhase = self.currentPhase
+    self.begin(phase)
+    defer {
+      if let enclosingPhase {
+        self.begin(enclosingPhase)
+      } else {
+        self.end()
+      }
+    }
+    return try body()
+  }
+}
+
+/// Returns the peak resident memory of the current process in bytes.
+private func peakResidentMemory() -> Int {
+  var usage = rusage()
+  guard getrusage(RUSAGE_SELF, &usage) == 0 else { return 0 }
+  #if canImport(Darwin)
+  // Darwin reports `ru_maxrss` in bytes.
+  return Int(usage.ru_maxrss)
+  #else
+  // Linux reports `ru_maxrss` in kilobytes.
+  return Int(usage.ru_maxrss) * 1024
+  #endif
+}
+
+extension Statistics {
+  func report(format: StatisticsFormat) -> String {
+    switch format {
+    case .text:
+      self.textReport()
+    case .json:
+      self.jsonReport()
+    }
+  }
+
+  private func textReport() -> String {
+    func pad(_ string: String, _ width: Int) -> String {
+      String(repeating: " ", count: max(0, width - string.count)) + string
+    }
+
+    var report = "svd2swift statistics:\n"
+    report += "  phase    " + pad("wall time", 12) + pad("peak memory", 14)
+    report += "\n"
+    var totalWallTime: UInt64 = 0
+    for phase in Phase.allCases {
+      let measurement = self.phases[phase, default: .init()]
+      totalWallTime += measurement.wallTime
+      let name = phase.rawValue
+      report += "  \(name)" + String(repeating: " ", count: 9 - name.count)
+      report += pad(formatDuration(measurement.wallTime), 12)
+      report += pad(formatBytes(measurement.peakMemory), 14)
+      report += "\n"
+    }
+    report += "  total    " + pad(formatDuration(totalWallTime), 12) + "\n"
+    report += "  peripherals:     \(self.counts.peripherals)\n"
+    report += "  registers:       \(self.counts.registers)\n"
+    report += "  fields:          \(self.counts.fields)\n"
+    report += "  enumerations:    \(self.counts.enumerations)\n"
+    report += "  files generated: \(self.filesGenerated)\n"
+    report += "  bytes generated: \(self.bytesGenerated)\n"
+    return report
+  }
+
+  private func jsonReport() -> String {
+    var phases: [String: Any] = [:]
+    for phase in Phase.allCases {
+      let measurement = self.phases[phase, default: .init()]
+      phases[phase.rawValue] = [
+        "wallTimeNanoseconds": Int(measurement.wallTime),
+        "peakMemoryBytes": measurement.peakMemory,
+      ]
+    }
+    let object: [String: Any] = [
+      "phases": phases,
+      "counts": [
+        "peripherals": self.counts.peripherals,
+        "registers": self.counts.registers,
+        "fields": self.counts.fields,
+        "enumerations": self.counts.enumerations,
+      ],
+      "filesGenerated": self.filesGenerated,
+      "bytesGenerated": self.bytesGenerated,
+    ]
+    guard
+      let data = try? JSONSerialization.data(
+        withJSONObject: object,
+        options: [.prettyPrinted, .sortedKeys]),
+      let string = String(data: data, encoding: .utf8)
+    else { return "{}\n" }
+    return string + "\n"
+  }
+}
+
+private func formatDuration(_ nanoseconds: UInt64) -> String {
+  let milliseconds = Double(nanoseconds) / 1_000_000
+  return String(format: "%.2f ms", milliseconds)
+}
+
+private func formatBytes(_ bytes: Int) -> String {
+  let mebibytes = Double(bytes) / (1024 * 1024)
+  return String(format: "%.1f MiB", mebibytes)
+}
@@ -0,0 +1,200 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import Foundation
+import MMIOUtilities
+import SVD2LLDB
+
+@main
+struct SVDInspector: ParsableCommand {
+  static let configuration = CommandConfiguration(
+    commandName: "svd-inspector",
+    abstract: "Run SVD2LLDB commands against captured memory images.",
+    discussion: """
+      Each image is either a raw memory dump, specified as '<path>@<address>' \
+      where address is the target address of the first byte of the dump, or \
+      an ELF file such as a core file, specified as '<path>'. Images are \
+      inspected concurrently and their reports are printed in the order the \
+      images were specified. Alternatively, commands run against a live \
+      target through a gdb-remote stub, such as OpenOCD or pyOCD, specified \
+      with '--gdb-remote <host:port>'.
+      """)
+
+  @Option(
+    name: [.short, .customLong("input")],
+    help: "Specify the input SVD file.",
+    completion: .file(extensions: ["svd"]))
+  var inputSVDFile: String
+
+  @Option(
+    name: [.short, .customLong("command")],
+    help: .init(
+      """
+      Specify a command to run against each image, for example \
+      'read TIMER0'. Only the 'decode', 'info', and 'read' commands are \
+      available. Commands run in the order they are specified.
+      """,
+      valueName: "command"))
+  var commands: [String]
+
+  @Option(
+    name: [.short, .long],
+    help:
+      """
+      Specify the maximum number of images to inspect concurrently. Skipping \
+      this option uses the number of active processors.
+      """)
+  var jobs: Int?
+
+  @Option(
+    help: .init(
+      """
+      Run the commands against the memory of a live target served by the \
+      gdb-remote stub listening on this address, instead of against images.
+      """,
+      valueName: "host:port"))
+  var gdbRemote: String?
+
+  @Argument(
+    help: .init(
+      "Memory images to inspect.",
+      valueName: "path[@address]"),
+    completion: .file())
+  var images: [String]
+
+  func validate() throws {
+    if let jobs = self.jobs, jobs < 1 {
+      throw ValidationError(
+        "Invalid value '\(jobs)' for '--jobs', expected a positive integer.")
+    }
+    if self.commands.isEmpty {
+      throw ValidationError("Missing expected argument '--command <command>'.")
+    }
+    if let gdbRemote = self.gdbRemote {
+      guard self.images.isEmpty else {
+        throw ValidationError(
+          "Images cannot be inspected with '--gdb-remote \(gdbRemote)'.")
+      }
+      _ = try Self.stubLocation(gdbRemote)
+      return
+    }
+    if self.images.isEmpty {
+      throw ValidationError("Missing expected argument '<path[@address]> ...'.")
+    }
+    for image in self.images {
+      _ = try Self.imageLocation(image)
+    }
+  }
+
+  /// Splits an image argument into the path of the file and the base address
+  /// of raw memory images.
+  static func imageLocation(
+    _ argument: String
+  ) throws -> (path: String, baseAddress: UInt64?) {
+    guard let separator = argument.lastIndex(of: "@") else {
+      return (argument, nil)
+    }
+    let address = argument[argument.index(after: separator)...]
+    guard
+      let baseAddress = SwiftIntegerParser<UInt64>().parseAll(String(address))
+    else {
+      throw ValidationError(
+        "Invalid base address '\(address)' for image '\(argument)'.")
+    }
+    return (String(argument[..<separator]), baseAddress)
+  }
+
+  /// Splits a gdb-remote argument into the host and port of the stub.
+  static func stubLocation(
+    _ argument: String
+  ) throws -> (host: String, port: Int) {
+    guard
+      let separator = argument.lastIndex(of: ":"),
+      let port = Int(argument[argument.index(after: separator)...]),
+      0 < port, port <= 0xffff
+    else {
+      throw ValidationError(
+        "Invalid value '\(argument)' for '--gdb-remote', expected host:port.")
+    }
+    let host = argument[..<separator]
+    return (host.isEmpty ? "localhost" : String(host), port)
+  }
+
+  func run() throws {
+    let inspector = try OfflineInspector(
+      contentsOf: URL(fileURLWithPath: self.inputSVDFile))
+    let commands = self.commands.map { command in
+      command.split(whereSeparator: \.isWhitespace).map(String.init)
+    }
+
+    if let gdbRemote = self.gdbRemote {
+      let location = try Self.stubLocation(gdbRemote)
+      var success = true
+      let reports = try inspector.run(
+        commands: commands,
+        host: location.host,
+        port: location.port)
+      for report in reports {
+        print("$ svd \(report.command.joined(separator: " "))")
+        print(report.output)
+        success = success && report.success
+      }
+      if !success {
+        throw ExitCode.failure
+      }
+      return
+    }
+
+    // Inspect each image on a worker thread, reports are buffered so they can
+    // be printed in the order the images were specified.
+    let reports = Mutex<[Int: (name: String, text: String, success: Bool)]>([:])
+    concurrentForEach(
+      Array(self.images.enumerated()),
+      maximumConcurrency: self.jobs
+        ?? ProcessInfo.processInfo.activeProcessorCount
+    ) { index, argument in
+      var text = ""
+      var success = true
+      do {
+        let location = try Self.imageLocation(argument)
+        let image = try MemoryImage(
+          contentsOf: URL(fileURLWithPath: location.path),
+          baseAddress: location.baseAddress)
+        for report in inspector.run(commands: commands, image: image) {
+          if !text.isEmpty { text.append("\n") }
+          text.append("$ svd \(report.command.joined(separator: " "))\n")
+          text.append(report.output)
+          success = success && report.success
+        }
+      } catch {
+        text = "error: \(error)"
+        success = false
+      }
+      reports.withLock { $0[index] = (argument, text, success) }
+    }
+
+    let finished = reports.withLock { $0 }
+    var success = true
+    for index in self.images.indices {
+      guard let report = finished[index] else {
+        preconditionFailure("Missing report for '\(self.images[index])'")
+      }
+      if index > 0 { print() }
+      print("==> \(report.name) <==")
+      print(report.text)
+      success = success && report.success
+    }
+    if !success {
+      throw ExitCode.failure
+    }
+  }
+}
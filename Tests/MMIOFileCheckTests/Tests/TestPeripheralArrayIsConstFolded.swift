@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIO
+
+// Mirrors the code svd2swift generates for evenly spaced peripheral instances
+// such as UART0 through UART7.
+@RegisterBlock
+struct UART0 {
+  @RegisterBlock(offset: 0x20)
+  var data: Register<DATA>
+}
+
+@Register(bitWidth: 32)
+struct DATA {
+  @ReadWrite(bits: 0..<8)
+  var value: VALUE
+}
+
+let uart = RegisterArray<UART0>(
+  unsafeAddress: 0x4000_0000, stride: 0x1000, count: 8)
+
+public func mainConstant() {
+  // CHECK-LABEL: void @"$s4main12mainConstantyyF"()
+  uart[3].data.write { _ in }
+  // CHECK: store volatile i32 0
+  // CHECK-SAME: 1073754144
+}
+
+public func mainDynamic(_ index: Int) {
+  // CHECK-LABEL: void @"$s4main11mainDynamicyySiF"(
+  uart[index].data.write { _ in }
+  // CHECK-NOT: switch
+  // CHECK: shl
+  // CHECK-SAME: 12
+  // CHECK: 1073741856
+  // CHECK: store volatile i32 0
+}
@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIO
+
+@Register(bitWidth: 32)
+struct R32 {
+  @ReadWrite(bits: 0..<2, stride: 2, count: 16)
+  var mode: MODE
+}
+let r32 = Register<R32>(unsafeAddress: 0x1000)
+
+public func main32() {
+  // CHECK-LABEL: void @"$s4main6main32yyF"()
+  r32.modify {
+    $0.raw.mode[0] = 1
+    $0.raw.mode[15] = 2
+  }
+  // CHECK: %0 = load volatile i32
+  // CHECK-NEXT: %1 = and i32 %0, 1073741820
+  // CHECK-NEXT: %2 = or disjoint i32 %1, -2147483647
+  // CHECK-NEXT: store volatile i32 %2
+}
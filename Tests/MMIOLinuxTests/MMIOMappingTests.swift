@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+#if canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+import MMIO
+import MMIOLinux
+import MMIOLinuxShims
+import Testing
+
+struct MMIOMappingTests {
+  @RegisterBlock
+  struct FakeDevice {
+    @RegisterBlock(offset: 0x0)
+    var control: Register<Control>
+    @RegisterBlock(offset: 0x100, stride: 0x10, count: 4)
+    var channels: RegisterArray<Control>
+  }
+
+  @Register(bitWidth: 32)
+  struct Control {
+    @ReadWrite(bits: 0..<1, as: Bool.self)
+    var enable: ENABLE
+    @Reserved(bits: 1..<8)
+    var reserved0: Reserved0
+    @ReadWrite(bits: 8..<16)
+    var divider: DIVIDER
+    @Reserved(bits: 16..<32)
+    var reserved1: Reserved1
+  }
+
+  /// Returns the 32-bit value at `offset` in a mapping.
+  func load(_ mapping: MMIOMapping, at offset: UInt) -> UInt32? {
+    mapping.withUnsafeAddress(at: offset, count: 4) { address in
+      UnsafePointer<UInt32>(bitPattern: address)?.pointee
+    }
+  }
+
+  @Test func anonymous() throws {
+    let mapping = try MMIOMapping(
+      anonymousNamed: "MMIOMappingTests", size: 0x1000)
+    #expect(mapping.size == 0x1000)
+    #expect(mapping.unsafeBaseAddress.isMultiple(of: 0x1000))
+
+    mapping.withRegisterBlock(FakeDevice.self) { device in
+      #expect(!device.control.read().enable)
+      device.control.modify {
+        $0.enable = true
+        $0.raw.divider = 0x42
+      }
+      device.channels[2].write { $0.raw.divider = 0x7 }
+    }
+    #expect(self.load(mapping, at: 0x0) == 0x0000_4201)
+    #expect(self.load(mapping, at: 0x120) == 0x0000_0700)
+
+    // Register blocks may be placed at any offset in the mapping.
+    mapping.withRegisterBlock(Register<Control>.self, at: 0x110) { control in
+      control.write { $0.enable = true }
+    }
+    #expect(self.load(mapping, at: 0x110) == 0x0000_0001)
+
+    // Registers may end at the last byte of the mapping.
+    mapping.withRegisterBlock(Register<Control>.self, at: 0xffc) { control in
+      control.write { $0.raw.divider = 0x3 }
+    }
+    #expect(self.load(mapping, at: 0xffc) == 0x0000_0300)
+  }
+
+  @Test func fileDescriptor() throws {
+    let descriptor = mmio_memfd_create("MMIOMappingTests", 0)
+    try #require(descriptor >= 0)
+    defer { close(descriptor) }
+    try #require(ftruncate(descriptor, 0x3000) == 0)
+    var bytes: [UInt8] = [0x01, 0x42, 0x00, 0x00]
+    try #require(pwrite(descriptor, &bytes, bytes.count, 0x2004) == 4)
+
+    // Offsets which are not page aligned are mapped from the start of their
+    // page.
+    let mapping = try MMIOMapping(
+      fileDescriptor: descriptor, offset: 0x2004, size: 0x10)
+    #expect(mapping.size == 0x10)
+    #expect(mapping.unsafeBaseAddress % 0x1000 == 0x4)
+
+    mapping.withRegisterBlock(Register<Control>.self) { control in
+      let value = control.read()
+      #expect(value.enable)
+      #expect(value.raw.divider == 0x42)
+      control.modify { $0.raw.divider = 0x24 }
+    }
+
+    // Writes are shared with the underlying file.
+    try #require(pread(descriptor, &bytes, bytes.count, 0x2004) == 4)
+    #expect(bytes == [0x01, 0x24, 0x00, 0x00])
+  }
+
+  @Test func errors() {
+    #expect(throws: MMIOMappingError.self) {
+      try MMIOMapping(uioDevice: "/dev/uio-missing")
+    }
+    #expect(throws: MMIOMappingError.self) {
+      try MMIOMapping(vfioDevice: "ffff:ff:1f.7", bar: 0)
+    }
+    #expect(throws: MMIOMappingError.self) {
+      try MMIOMapping(anonymousNamed: "MMIOMappingTests", size: 0)
+    }
+  }
+}
+#endif
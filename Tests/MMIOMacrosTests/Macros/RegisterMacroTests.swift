@@ -544,6 +544,92 @@ struct RegisterMacroTests {
       indentationWidth: Self.indentationWidth)
   }
 
+  @Test func expansion_bitFieldArray() {
+    assertMacroExpansion(
+      """
+      @Register(bitWidth: 0x8)
+      struct S {
+        @ReadWrite(bits: 0..<2, stride: 2, count: 4, as: Mode.self)
+        var mode: MODE
+      }
+      """,
+      expandedSource: """
+        struct S {
+          @available(*, unavailable)
+          var mode: MODE {
+            get {
+              fatalError()
+            }
+          }
+
+          private init() {
+            fatalError()
+          }
+
+          private var _never: Never
+
+          enum MODE: BitFieldArray {
+            typealias Storage = UInt8
+            typealias Projection = Mode
+            static let bitRange = 0 ..< 2
+            static let bitStride = 2
+            static let count = 4
+          }
+
+          struct Raw: RegisterValueRaw {
+            typealias Value = S
+            typealias Storage = UInt8
+            var storage: Storage
+            init(_ storage: Storage) {
+              self.storage = storage
+            }
+            init(_ value: Value.ReadWrite) {
+              self.storage = value.storage
+            }
+            var mode: BitFieldArrayRawView<MODE> {
+              @inlinable @inline(__always) get {
+                .init(self.storage)
+              }
+              @inlinable @inline(__always) set {
+                self.storage = newValue.storage
+              }
+            }
+          }
+
+          typealias Read = ReadWrite
+
+          typealias Write = ReadWrite
+
+          struct ReadWrite: RegisterValueRead, RegisterValueWrite {
+            typealias Value = S
+            var storage: UInt8
+            init(_ value: ReadWrite) {
+              self.storage = value.storage
+            }
+            init(_ value: Raw) {
+              self.storage = value.storage
+            }
+            var mode: BitFieldArrayView<MODE> {
+              @inlinable @inline(__always) get {
+                .init(self.storage)
+              }
+              @inlinable @inline(__always) set {
+                self.storage = newValue.storage
+              }
+            }
+          }
+        }
+
+        extension S: RegisterValue {
+        }
+        """,
+      macros: [
+        "Register": RegisterMacro.self,
+        "ReadWrite": ReadWriteArrayMacro.self,
+      ],
+      indentationWidth: Self.indentationWidth)
+  }
+
   @Test func expansion_asymmetric() {
     assertMacroExpansion(
       """
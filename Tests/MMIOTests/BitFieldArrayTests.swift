@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import MMIO
+
+struct BitFieldArrayTests {
+  enum Mode: BitFieldArray {
+    typealias Storage = UInt32
+    typealias Projection = Never
+    static let bitRange = 0..<2
+    static let bitStride = 2
+    static let count = 16
+  }
+
+  enum Flag: BitFieldArray {
+    typealias Storage = UInt32
+    typealias Projection = Bool
+    static let bitRange = 1..<2
+    static let bitStride = 4
+    static let count = 8
+  }
+
+  @Test func bitRangeAtIndex() {
+    #expect(Mode.bitWidth == 2)
+    #expect(Mode.bitRange(at: 0) == 0..<2)
+    #expect(Mode.bitRange(at: 3) == 6..<8)
+    #expect(Mode.bitRange(at: 15) == 30..<32)
+
+    #expect(Flag.bitWidth == 1)
+    #expect(Flag.bitRange(at: 0) == 1..<2)
+    #expect(Flag.bitRange(at: 7) == 29..<30)
+  }
+
+  @Test func extractBits() {
+    let storage: UInt32 = 0b11_10_01_00
+    #expect(Mode.extractBits(at: 0, from: storage) == 0b00)
+    #expect(Mode.extractBits(at: 1, from: storage) == 0b01)
+    #expect(Mode.extractBits(at: 2, from: storage) == 0b10)
+    #expect(Mode.extractBits(at: 3, from: storage) == 0b11)
+    #expect(Mode.extractBits(at: 4, from: storage) == 0b00)
+  }
+
+  @Test func insertBits() {
+    var storage: UInt32 = 0xffff_ffff
+    Mode.insertBits(0b01, at: 3, into: &storage)
+    #expect(storage == 0xffff_ff7f)
+    Mode.insertBits(0b00, at: 15, into: &storage)
+    #expect(storage == 0x3fff_ff7f)
+  }
+
+  @Test func views() {
+    var raw = BitFieldArrayRawView<Mode>(0)
+    #expect(raw.count == 16)
+    raw[2] = 0b11
+    raw[5] = 0b10
+    #expect(raw.storage == 0b10_00_00_11_00_00)
+    #expect(raw[5] == 0b10)
+
+    var flags = BitFieldArrayView<Flag>(0)
+    flags[0] = true
+    flags[7] = true
+    #expect(flags.storage == 0x2000_0002)
+    #expect(flags[0])
+    #expect(!flags[1])
+    #expect(flags[7])
+  }
+}
@@ -95,6 +95,16 @@ struct RegisterWithValues {
   var reg: Field
 }
 
+@Register(bitWidth: 32)
+struct RegisterWithArrays {
+  @ReadWrite(bits: 0..<1, stride: 4, count: 8, as: Bool.self)
+  var enable: Enable
+  @ReadOnly(bits: 1..<2, stride: 4, count: 8, as: Bool.self)
+  var status: Status
+  @WriteOnly(bits: 2..<4, stride: 4, count: 8)
+  var clear: Clear
+}
+
 @RegisterBlock
 struct Block {
   @RegisterBlock(offset: 0x4)
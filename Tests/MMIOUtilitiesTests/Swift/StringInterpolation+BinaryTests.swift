@@ -127,4 +127,15 @@ struct StringInterpolationBinaryTests {
     #expect("\(binary: Int8(1), bits: 5)" == "0b0_0001")
     #expect("\(binary: Int8.max, bits: 5)" == "0b1_1111")
   }
+
+  @Test func appendInterpolation_binaryWords() {
+    #expect("\(binary: [0b1011], bits: 4)" == "0b1011")
+    #expect("\(binary: [0b1011], bits: 6)" == "0b00_1011")
+    #expect(
+      "\(binary: [0x1, 0x1], bits: 65, segmented: false)"
+        == "0b1" + String(repeating: "0", count: 63) + "1")
+    #expect(
+      "\(binary: [0, 0xf], bits: 68)"
+        == "0b1111" + String(repeating: "_0000", count: 16))
+  }
 }
@@ -140,4 +140,17 @@ struct StringInterpolationHexTests {
     #expect("\(hex: UInt64(1), bits: 8)" == "0x01")
     #expect("\(hex: UInt64.max, bits: 8)" == "0xff")
   }
+
+  @Test func appendInterpolation_hexWords() {
+    #expect(
+      "\(hex: [0x0123_4567_89ab_cdef, 0xfedc_ba98], bits: 96)"
+        == "0xfedc_ba98_0123_4567_89ab_cdef")
+    #expect(
+      "\(hex: [UInt64.max, UInt64.max], bits: 72)"
+        == "0xff_ffff_ffff_ffff_ffff")
+    #expect(
+      "\(hex: [UInt64.max, UInt64.max], bits: 66)"
+        == "0x3_ffff_ffff_ffff_ffff")
+    #expect("\(hex: [0x1234], bits: 16)" == "0x1234")
+  }
 }
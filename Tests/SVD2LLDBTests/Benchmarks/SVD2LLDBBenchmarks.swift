@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2LLDB
+
+/// Representative svd2lldb workloads run against a simulated debug probe.
+///
+/// Each benchmark reports the number of memory transactions, the number of
+/// bytes transferred, and the simulated time spent on the wire for every link
+/// in ``links``. Transaction counts are link independent and are checked
+/// exactly so regressions in read coalescing and caching fail the tests.
+struct SVD2LLDBBenchmarks {
+  static let links: [SVD2LLDBSimulatedLink] = [.swd(), .jtag()]
+
+  /// A large device of 16 peripherals with 64 contiguous 32-bit registers of
+  /// 4 fields each. Every 16th register is cleared on read.
+  static let device = SVDDevice(
+    name: "BenchmarkDevice",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(size: 32),
+    peripherals: .init(
+      peripheral: (0..<16).map { peripheral in
+        .init(
+          name: "PERIPH\(peripheral)",
+          baseAddress: 0x4000_0000 + UInt64(peripheral) * 0x1000,
+          registers: .init(
+            cluster: [],
+            register: (0..<64).map { register in
+              .init(
+                name: "REG\(register)",
+                addressOffset: UInt64(register) * 4,
+                readAction: register % 16 == 15 ? .clear : nil,
+                fields: .init(
+                  field: (0..<4).map { field in
+                    .init(
+                      name: "F\(field)",
+                      bitRange: .lsbMsb(
+                        .init(lsb: field * 8, msb: field * 8 + 7)))
+                  }))
+            }))
+      }))
+
+  struct Session {
+    var context: SVD2LLDB
+    var debugger: SVD2LLDBSimulatedDebugger
+
+    /// Runs a command, expecting it to succeed.
+    mutating func run<Command: SVD2LLDBCommand>(
+      _: Command.Type,
+      _ arguments: [String],
+      sourceLocation: SourceLocation = #_sourceLocation
+    ) {
+      var result = SVD2LLDBTestResult()
+      let success = Command.run(
+        arguments: arguments,
+        debugger: &self.debugger,
+        result: &result,
+        context: self.context)
+      #expect(success, "\(result)", sourceLocation: sourceLocation)
+    }
+  }
+
+  /// Runs a workload against each simulated link and reports the cost of the
+  /// transactions performed by `measure`, excluding those of `setup`.
+  ///
+  /// Returns the statistics of the first link.
+  func benchmark(
+    _ name: String,
+    setup: (inout Session) -> Void = { _ in },
+    sourceLocation: SourceLocation = #_sourceLocation,
+    measure: (inout Session) -> Void
+  ) -> SVD2LLDBSimulatedDebugger.Statistics {
+    var results: [SVD2LLDBSimulatedDebugger.Statistics] = []
+    for link in Self.links {
+      var session = Session(
+        context: SVD2LLDB(device: Self.device),
+        debugger: SVD2LLDBSimulatedDebugger(link: link))
+      setup(&session)
+      session.debugger.statistics = .init()
+      measure(&session)
+
+      let statistics = session.debugger.statistics
+      let milliseconds = statistics.time / 1_000_000
+      let microseconds = statistics.time / 1_000 % 1_000
+      let digits = "\(microseconds)"
+      var fraction = String(repeating: "0", count: 3 - digits.count)
+      fraction.append(digits)
+      print(
+        """
+        benchmark: \(name) (\(link.name)): \(statistics.transactions) \
+        transactions, \(statistics.bytes) bytes, \(milliseconds).\(fraction) ms
+        """)
+      results.append(statistics)
+    }
+
+    let transactions = results.map(\.transactions)
+    #expect(
+      Set(transactions).count <= 1,
+      "Transactions differ between links: \(transactions)",
+      sourceLocation: sourceLocation)
+    return results.first ?? .init()
+  }
+
+  @Test func cost() {
+    let swd = SVD2LLDBSimulatedLink.swd()
+    // 1 ms of latency plus 11.5 µs per word at 4 MHz.
+    #expect(swd.cost(bytes: 0) == 1_000_000)
+    #expect(swd.cost(bytes: 1) == 1_011_500)
+    #expect(swd.cost(bytes: 4) == 1_011_500)
+    #expect(swd.cost(bytes: 60) == 1_172_500)
+    #expect(SVD2LLDBSimulatedLink.jtag().cost(bytes: 8) == 1_010_400)
+  }
+
+  @Test func readDevice() {
+    // Each peripheral is read in 4 blocks of 15 registers, split around the
+    // registers which are cleared on read.
+    let cold = self.benchmark("read device") {
+      $0.run(ReadCommand.self, ["PERIPH*"])
+    }
+    #expect(cold == .init(reads: 64, bytes: 3840, time: 75_040_000))
+
+    let uncoalesced = self.benchmark("read device uncoalesced") {
+      $0.run(ReadCommand.self, ["PERIPH*", "--max-block", "4"])
+    }
+    #expect(uncoalesced == .init(reads: 960, bytes: 3840, time: 971_040_000))
+  }
+
+  @Test func readDeviceCached() {
+    let warm = self.benchmark(
+      "read device cached",
+      setup: { $0.run(ReadCommand.self, ["PERIPH*"]) },
+      measure: { $0.run(ReadCommand.self, ["PERIPH*"]) })
+    #expect(warm == .init())
+
+    let resumed = self.benchmark(
+      "read device resumed",
+      setup: { $0.run(ReadCommand.self, ["PERIPH*"]) },
+      measure: {
+        $0.debugger.resume()
+        $0.run(ReadCommand.self, ["PERIPH*"])
+      })
+    #expect(resumed.reads == 64)
+  }
+
+  @Test func decode() {
+    let cold = self.benchmark("decode register") {
+      $0.run(DecodeCommand.self, ["PERIPH3.REG7", "--read"])
+    }
+    #expect(cold == .init(reads: 1, bytes: 4, time: 1_011_500))
+
+    let warm = self.benchmark(
+      "decode register cached",
+      setup: { $0.run(ReadCommand.self, ["PERIPH3"]) },
+      measure: { $0.run(DecodeCommand.self, ["PERIPH3.REG7", "--read"]) })
+    #expect(warm == .init())
+  }
+
+  @Test func write() {
+    let field = self.benchmark("write field") {
+      $0.run(WriteCommand.self, ["PERIPH0.REG0.F0=0x12"])
+    }
+    #expect(field == .init(reads: 1, writes: 1, bytes: 8, time: 2_023_000))
+
+    // Adjacent partially written registers are read in a single block.
+    let fields = self.benchmark("write fields") {
+      $0.run(
+        WriteCommand.self,
+        ["PERIPH0.REG0.F0=0x1", "PERIPH0.REG1.F1=0x2"])
+    }
+    #expect(fields == .init(reads: 1, writes: 2, bytes: 16, time: 3_046_000))
+
+    let register = self.benchmark("write register") {
+      $0.run(WriteCommand.self, ["PERIPH0.REG0=0x1234_5678"])
+    }
+    #expect(register == .init(writes: 1, bytes: 4, time: 1_011_500))
+  }
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import MMIOUtilities
+import Testing
+
+@testable import SVD2LLDB
+
+struct CompleteCommandTests {
+  @Test func argumentParsing() {
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["--help"],
+      success: true,
+      debugger: "",
+      result: """
+        OVERVIEW: List key-paths completing a partial key-path.
+
+        USAGE: svd complete [<key-path>] [--limit <limit>]
+
+        ARGUMENTS:
+          <key-path>              Partial key-path to complete, ignoring case.
+
+        OPTIONS:
+          --limit <limit>         Maximum completions to list. (default: 100)
+          -h, --help              Show help information.
+
+        """)
+  }
+
+  @Test func complete() {
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["testperipheral.testregister"],
+      success: true,
+      debugger: "",
+      result: """
+        TestPeripheral.TestRegister0
+        TestPeripheral.TestRegister1
+        TestPeripheral.TestRegister2
+        TestPeripheral.TestRegister3
+        """)
+
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["TestPeripheral.TestRegister3.C"],
+      success: true,
+      debugger: "",
+      result: """
+        TestPeripheral.TestRegister3.CAPEDGE
+        TestPeripheral.TestRegister3.CAPSRC
+        TestPeripheral.TestRegister3.CNT
+        TestPeripheral.TestRegister3.CNTSRC
+        """)
+
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["TestPeripheral.TestRegister", "--limit", "1"],
+      success: true,
+      debugger: "",
+      result: """
+        TestPeripheral.TestRegister0
+        """)
+
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["TestDevice:testperipheral.testregister2"],
+      success: true,
+      debugger: "",
+      result: """
+        testdevice:TestPeripheral.TestRegister2
+        """)
+  }
+
+  @Test func noCompletions() {
+    assertCommand(
+      command: CompleteCommand.self,
+      arguments: ["Unknown"],
+      success: false,
+      debugger: "",
+      result: """
+        error: No completions for “Unknown”.
+        """)
+  }
+}
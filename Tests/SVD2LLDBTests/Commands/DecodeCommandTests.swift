@@ -13,6 +13,7 @@ import CLLDB
 import MMIOUtilities
 import Testing
 
+@testable import SVD
 @testable import SVD2LLDB
 
 struct DecodeCommandTests {
@@ -254,4 +255,67 @@ struct DecodeCommandTests {
         [0:0]   EN      0x1 (Enable)
         """)
   }
+
+  /// A variant of the test device with a 96 bit wide register.
+  static let wideDevice: SVDDevice = {
+    var variant = device
+    variant.peripherals.peripheral[0].registers?.register[0]
+      .registerProperties.size = 96
+    variant.peripherals.peripheral[0].registers?.register[0].fields?.field
+      .append(.init(name: "Wide", bitRange: .lsbMsb(.init(lsb: 8, msb: 87))))
+    return variant
+  }()
+
+  /// Runs `svd decode` in a context with the wide test device loaded.
+  func decodeWide(
+    _ arguments: [String]
+  ) -> (success: Bool, debugger: SVD2LLDBTestDebugger, result: String) {
+    let context = SVD2LLDB(device: Self.wideDevice)
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    let success = DecodeCommand.run(
+      arguments: arguments,
+      debugger: &debugger,
+      result: &result,
+      context: context)
+    return (success, debugger, result.description)
+  }
+
+  @Test func decodeWide() throws {
+    let existing = self.decodeWide([
+      "TestPeripheral.TestRegister0", "0x0123_4567_89ab_cdef_0011_2233",
+    ])
+    #expect(existing.success)
+    #expect(existing.debugger.trace.isEmpty)
+    #expect(
+      existing.result == """
+        TestPeripheral.TestRegister0: 0x0123_4567_89ab_cdef_0011_2233
+
+        [87:8] Wide   0x2345_6789_abcd_ef00_1122
+        [7:7]  Field1 0x0
+        [4:1]  Field0 0x9
+        """)
+
+    let large = self.decodeWide([
+      "TestPeripheral.TestRegister0", "0x1_0123_4567_89ab_cdef_0011_2233",
+    ])
+    #expect(!large.success)
+    #expect(
+      large.result == """
+        error: Invalid value “0x1_0123_4567_89ab_cdef_0011_2233“ larger than register size “96“ bits.
+        """)
+
+    // Wide registers are read whole in a single transaction.
+    let read = self.decodeWide(["TestPeripheral.TestRegister0", "--read"])
+    #expect(read.success)
+    try #require(read.debugger.trace.count == 1)
+    guard case .readBytes(0x1000, let bytes) = read.debugger.trace[0] else {
+      Issue.record("Unexpected transaction: \(read.debugger)")
+      return
+    }
+    #expect(bytes.count == 12)
+    let value = WideValue(bytes: bytes, bits: 96)
+    #expect(
+      read.result.hasPrefix("TestPeripheral.TestRegister0: \(value)\n"))
+  }
 }
@@ -0,0 +1,193 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import SVD2LLDB
+
+struct DiffCommandTests {
+  @Test func argumentParsing() {
+    assertCommand(
+      command: DiffCommand.self,
+      arguments: ["--help"],
+      success: true,
+      debugger: "",
+      result: """
+        OVERVIEW: Compare register values with a snapshot.
+
+        USAGE: svd diff <path> [<key-path> ...] [--against <path>]
+
+        ARGUMENTS:
+          <path>                  Path to snapshot file.
+          <key-path>              Key-path to a peripheral, cluster, register, or field.
+
+        OPTIONS:
+          --against <path>        Snapshot to compare against instead of the target.
+          -h, --help              Show help information.
+
+        """)
+  }
+
+  func temporaryPath() -> String {
+    FileManager.default.temporaryDirectory
+      .appendingPathComponent("\(UUID()).svds").path
+  }
+
+  func write(_ values: [UInt64: UInt64]) throws -> String {
+    let snapshot = RegisterSnapshot(
+      fingerprint: DeviceIndex(device: device).fingerprint,
+      values: values)
+    let path = self.temporaryPath()
+    try Data(snapshot.encoded()).write(to: URL(fileURLWithPath: path))
+    return path
+  }
+
+  func run(
+    _ arguments: [String],
+    debugger: inout SVD2LLDBTestDebugger
+  ) -> (Bool, SVD2LLDBTestResult) {
+    var result = SVD2LLDBTestResult()
+    let success = DiffCommand.run(
+      arguments: arguments,
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: device))
+    return (success, result)
+  }
+
+  @Test func diff_target() throws {
+    // The test debugger returns the same values for the same reads, so a
+    // snapshot of its registers matches the target.
+    let path = try self.write([
+      0x1000: 0x89fd_6c06,
+      0x1004: 0xcbd9,
+      0x1012: 0xae64_6aa8,
+    ])
+    defer { try? FileManager.default.removeItem(atPath: path) }
+
+    var debugger = SVD2LLDBTestDebugger()
+    var (success, result) = self.run([path], debugger: &debugger)
+    #expect(success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        """)
+    assertSVD2LLDBResult(result: result, output: "No differences.")
+
+    // The next reads of the test debugger return different values.
+    (success, result) = self.run([path], debugger: &debugger)
+    #expect(success)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06 -> 0x198c_8585
+              Field0:      0x3 -> 0x2
+              Field1:      0x0 -> 0x1
+            TestRegister1: 0xcbd9 -> 0xb303
+            TestRegister3: 0xae64_6aa8 -> 0x49fc_e611
+              EN:          0x0 (Disable) -> 0x1 (Enable)
+              CNT:         0x2 (Toggle) -> 0x0 (Count_UP)
+              MODE:        0x2 (Single_MATCH) -> 0x1 (Single_ZERO_MAX)
+              PSC:         0x1 (Enabled) -> 0x0 (Disabled)
+              CNTSRC:      0xa -> 0x6 (CAP_SRC_div64)
+              CAPSRC:      0x6 (GPIOA_5) -> 0xe (GPIOC_5)
+              TRGEXT:      0x2 (DMA2) -> 0x3 (UART)
+              RELOAD:      0x2 (RELOAD2) -> 0x1 (RELOAD1)
+              IDR:         0x3 -> 0x2 (DECREMENT)
+              S:           0x1 (START) -> 0x0 (STOP)
+        """)
+  }
+
+  @Test func diff_partialSnapshot() throws {
+    // Only the registers stored in a partial snapshot are read and compared.
+    let path = try self.write([0x1004: 0x7a7e])
+    defer { try? FileManager.default.removeItem(atPath: path) }
+
+    var debugger = SVD2LLDBTestDebugger()
+    var (success, result) = self.run([path], debugger: &debugger)
+    #expect(success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1004] -> 0x7a7e
+        """)
+    assertSVD2LLDBResult(result: result, output: "No differences.")
+
+    (success, result) = self.run([path], debugger: &debugger)
+    #expect(success)
+    #expect(debugger.trace.count == 2)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister1: 0x7a7e -> 0xae64
+        """)
+  }
+
+  @Test func diff_snapshots() throws {
+    let old = try self.write([
+      0x1000: 0x0000_0002,
+      0x1004: 0x1234,
+      0x1012: 0x0000_0001,
+    ])
+    let new = try self.write([
+      0x1000: 0x0000_0002,
+      0x1012: 0x0000_0030,
+    ])
+    defer {
+      try? FileManager.default.removeItem(atPath: old)
+      try? FileManager.default.removeItem(atPath: new)
+    }
+
+    var debugger = SVD2LLDBTestDebugger()
+    var (success, result) = self.run(
+      [old, "--against", new],
+      debugger: &debugger)
+    #expect(success)
+    #expect(debugger.trace.isEmpty)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister1: 0x1234 -> <missing>
+            TestRegister3: 0x0000_0001 -> 0x0000_0030
+              EN:          0x1 (Enable) -> 0x0 (Disable)
+              MODE:        0x0 (Continous) -> 0x3 (Reload_ZERO_MAX)
+        """)
+
+    (success, result) = self.run(
+      [old, "TestPeripheral.TestRegister0", "--against", new],
+      debugger: &debugger)
+    #expect(success)
+    assertSVD2LLDBResult(result: result, output: "No differences.")
+
+    (success, result) = self.run(
+      [
+        old, "TestPeripheral.TestRegister1", "TestPeripheral.R9",
+        "--against", new,
+      ],
+      debugger: &debugger)
+    #expect(!success)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister1: 0x1234 -> <missing>
+        error: Unknown item “TestPeripheral.R9”.
+        """)
+  }
+}
@@ -118,22 +118,49 @@ struct InfoCommandTests {
       ],
       success: false,
       debugger: "",
-      // FIXME: order lost.
       result: """
+        TestPeripheral.TestRegister2:
+          Address:               0x0000_0000_0000_1008
+          Bit Width:             32
+          Read Action:           clear
+
         TestDevice:
           Description:           A device to test the svd2lldb lldb plugin.
           Address Bit Alignment: 8
           Single Transfer Width: 32
           Peripherals:           [TestPeripheral]
 
-        TestPeripheral.TestRegister2:
-          Address:               0x0000_0000_0000_1008
-          Bit Width:             32
-          Read Action:           clear
-
         TestPeripheral.TestRegister0.Field0:
           Bit Range:             [4:1]
         error: Unknown item “TestPeripheral.Unknown”.
         """)
   }
+
+  @Test func info_pattern() {
+    assertCommand(
+      command: InfoCommand.self,
+      arguments: ["TestPeripheral.TestRegister[1..2]"],
+      success: true,
+      debugger: "",
+      result: """
+        TestPeripheral.TestRegister1:
+          Description: A simple register without fields.
+          Address:     0x0000_0000_0000_1004
+          Bit Width:   16
+
+        TestPeripheral.TestRegister2:
+          Address:     0x0000_0000_0000_1008
+          Bit Width:   32
+          Read Action: clear
+        """)
+
+    assertCommand(
+      command: InfoCommand.self,
+      arguments: ["TestPeripheral.TestRegister[0"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Invalid key path “TestPeripheral.TestRegister[0”.
+        """)
+  }
 }
@@ -9,9 +9,11 @@
 //
 //===----------------------------------------------------------------------===//
 
+import Foundation
 import MMIOUtilities
 import Testing
 
+@testable import SVD
 @testable import SVD2LLDB
 
 struct LoadCommandTests {
@@ -24,14 +26,264 @@ struct LoadCommandTests {
       result: """
         OVERVIEW: Load an SVD file from disk.
 
-        USAGE: svd load <path>
+        USAGE: svd load <path> [--namespace <name>]
 
         ARGUMENTS:
           <path>                  Path to SVD file.
 
         OPTIONS:
+          --namespace <name>      Namespace to load the device into, defaults to the file name.
           -h, --help              Show help information.
 
         """)
+
+    assertCommand(
+      command: LoadCommand.self,
+      arguments: ["Device.svd", "--namespace", "app:core"],
+      success: false,
+      debugger: "",
+      result: """
+        usage: svd load <path> [--namespace <name>]
+        error: Invalid namespace “app:core”.
+        """)
+  }
+
+  @Test func missingFile() {
+    assertCommand(
+      command: LoadCommand.self,
+      arguments: ["/nonexistent/Device.svd"],
+      success: false,
+      debugger: "",
+      result: """
+        error: No such file “/nonexistent/Device.svd”.
+        """)
+  }
+
+  @Test func backgroundLoad() {
+    let context = SVD2LLDB(device: nil)
+    let load = DeviceLoad(name: "TestDevice.svd") { _ in device }
+    context.add(load, namespace: "testdevice")
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+
+    // Commands wait for the background load to complete.
+    #expect(
+      InfoCommand.run(
+        arguments: ["TestPeripheral"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(result.error.isEmpty)
+    #expect(context.devices["testdevice"] === load)
+    #expect(context.selectedNamespace == "testdevice")
+  }
+
+  @Test func backgroundLoadProgress() {
+    let context = SVD2LLDB(device: nil)
+    let semaphore = DispatchSemaphore(value: 0)
+    let load = DeviceLoad(name: "TestDevice.svd") { _ in
+      semaphore.wait()
+      return device
+    }
+    context.add(load, namespace: "testdevice")
+    var messages: [String] = []
+    context.progressHandler = { message in
+      messages.append(message)
+      // Let the load finish once the command reports it is waiting.
+      semaphore.signal()
+    }
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+
+    // Progress is written immediately instead of to the command result.
+    #expect(
+      InfoCommand.run(
+        arguments: ["TestPeripheral"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(
+      messages == [
+        "Waiting for SVD file “TestDevice.svd” to load (pending)..."
+      ])
+    #expect(!result.output.contains("Waiting"))
+  }
+
+  @Test func backgroundLoadFailure() {
+    let context = SVD2LLDB(device: nil)
+    let load = DeviceLoad(name: "TestDevice.svd") { _ in
+      throw GenericError("Invalid XML.")
+    }
+    context.add(load, namespace: "testdevice")
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+
+    // The load error is reported by the first command needing the device.
+    #expect(
+      !InfoCommand.run(
+        arguments: ["TestPeripheral"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(
+      result.error == """
+        error: Failed to load SVD file “TestDevice.svd”: Invalid XML.
+        """)
+    #expect(context.devices.isEmpty)
+    #expect(context.selectedNamespace == nil)
+  }
+
+  static let radioDevice: SVDDevice = {
+    var variant = device
+    variant.name = "Radio"
+    variant.peripherals.peripheral[0].name = "RadioPeripheral"
+    variant.peripherals.peripheral[0].baseAddress = 0x2000
+    return variant
+  }()
+
+  /// Runs `svd read` in a context with the test and radio devices loaded.
+  func read(
+    _ arguments: [String],
+    success: Bool,
+    debugger expectedDebugger: String,
+    result expectedResult: String,
+    sourceLocation: SourceLocation = #_sourceLocation
+  ) {
+    let context = SVD2LLDB(device: device)
+    context.add(DeviceLoad(device: Self.radioDevice), namespace: "Radio")
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    #expect(
+      ReadCommand.run(
+        arguments: arguments,
+        debugger: &debugger,
+        result: &result,
+        context: context) == success,
+      sourceLocation: sourceLocation)
+    #expect(
+      debugger.description == expectedDebugger,
+      sourceLocation: sourceLocation)
+    assertSVD2LLDBResult(
+      result: result,
+      output: expectedResult,
+      sourceLocation: sourceLocation)
+  }
+
+  @Test func namespaces() {
+    // Key paths without a namespace refer to the last loaded device.
+    self.read(
+      ["RadioPeripheral.TestRegister1"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_2004] -> 0x7a7e
+        """,
+      result: """
+        Radio:
+          RadioPeripheral:
+            TestRegister1: 0x7a7e
+        """)
+
+    self.read(
+      ["TestDevice:TestPeripheral.TestRegister1"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1004] -> 0x7a7e
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister1: 0x7a7e
+        """)
+
+    self.read(
+      ["radio:RadioPeripheral", "testdevice:TestPeripheral"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Key paths refer to items in multiple namespaces “radio” and “testdevice”.
+        """)
+
+    self.read(
+      ["other:TestPeripheral"],
+      success: false,
+      debugger: "",
+      result: """
+        error: No SVD file loaded in namespace “other”.
+        """)
+  }
+
+  @Test func addresses() {
+    // Addresses are dispatched to the device mapping them.
+    self.read(
+      ["0x1005"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1004] -> 0x7a7e
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister1: 0x7a7e
+        """)
+
+    self.read(
+      ["0x2000", "RadioPeripheral.TestRegister1"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_2000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        """,
+      result: """
+        Radio:
+          RadioPeripheral:
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
+        """)
+
+    self.read(
+      ["0x9000"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Unknown item “0x9000”.
+        """)
+  }
+
+  @Test func reload() throws {
+    let url = FileManager.default.temporaryDirectory
+      .appendingPathComponent("LoadCommandTests-\(UUID().uuidString).svd")
+    try Data("<device/>".utf8).write(to: url)
+    defer { try? FileManager.default.removeItem(at: url) }
+
+    let context = SVD2LLDB(device: device)
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    #expect(
+      LoadCommand.run(
+        arguments: [url.path, "--namespace", "App"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    let load = try #require(context.devices["app"])
+    #expect(context.selectedNamespace == "app")
+
+    // Both devices stay loaded when switching between them.
+    context.selectedNamespace = "testdevice"
+    #expect(context.devices.count == 2)
+
+    // Reloading the unchanged file reuses the existing load.
+    #expect(
+      LoadCommand.run(
+        arguments: [url.path, "--namespace", "app"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(context.devices["app"] === load)
+    #expect(context.selectedNamespace == "app")
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        Loading SVD file: “\(url.lastPathComponent)” (namespace “app”).
+        Using loaded SVD file: “\(url.lastPathComponent)” (namespace “app”).
+        """)
   }
 }
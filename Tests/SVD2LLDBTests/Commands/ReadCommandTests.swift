@@ -12,6 +12,7 @@
 import MMIOUtilities
 import Testing
 
+@testable import SVD
 @testable import SVD2LLDB
 
 struct ReadCommandTests {
@@ -24,13 +25,15 @@ struct ReadCommandTests {
       result: """
         OVERVIEW: Read the value of registers
 
-        USAGE: svd read <key-path> ... [--force]
+        USAGE: svd read <key-path> ... [--force] [--max-gap <bytes>] [--max-block <bytes>]
 
         ARGUMENTS:
           <key-path>              Key-path to a peripheral, cluster, register, or field.
 
         OPTIONS:
           --force                 Always read ignoring side-effects.
+          --max-gap <bytes>       Largest gap to read between registers. (default: 0)
+          --max-block <bytes>     Largest bulk memory read. (default: 1024)
           -h, --help              Show help information.
 
         """)
@@ -41,7 +44,7 @@ struct ReadCommandTests {
       success: false,
       debugger: "",
       result: """
-        usage: svd read <key-path> ... [--force]
+        usage: svd read <key-path> ... [--force] [--max-gap <bytes>] [--max-block <bytes>]
         error: Missing expected argument '<key-path> ...'
         """)
   }
@@ -64,6 +67,15 @@ struct ReadCommandTests {
       result: """
         error: Invalid key path “.”.
         """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral.TestRegister[0"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Invalid key path “TestPeripheral.TestRegister[0”.
+        """)
   }
 
   @Test func unknownItem() {
@@ -81,10 +93,9 @@ struct ReadCommandTests {
       arguments: ["ABC", "DEF"],
       success: false,
       debugger: "",
-      // FIXME: order is backwards, see ReadCommand.render
       result: """
-        error: Unknown item “DEF”.
         error: Unknown item “ABC”.
+        error: Unknown item “DEF”.
         """)
   }
 
@@ -149,35 +160,31 @@ struct ReadCommandTests {
         "TestPeripheral.TestRegister1",
       ],
       success: true,
-      // FIXME: order is backwards
       debugger: """
-        m[0x0000_0000_0000_1004] -> 0x7a7e
-        m[0x0000_0000_0000_1000] -> 0xae64_6aa8
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
         """,
       result: """
         TestDevice:
           TestPeripheral:
-            TestRegister0: 0xae64_6aa8
-            TestRegister1: 0x7a7e
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
         """)
 
     assertCommand(
       command: ReadCommand.self,
       arguments: ["TestPeripheral"],
       success: true,
-      // FIXME: order is backwards
       debugger: """
-        m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9
-        m[0x0000_0000_0000_1004] -> 0xae64
-        m[0x0000_0000_0000_1000] -> 0x6204_b303
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
         """,
       result: """
         TestDevice:
           TestPeripheral:
-            TestRegister0: 0x6204_b303
-            TestRegister1: 0xae64
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
             TestRegister2: <skipped>
-            TestRegister3: 0x7a7e_cbd9
+            TestRegister3: 0xae64_6aa8
         warning: Skipped registers with side-effects. Use “--force” to read these registers.
         """)
 
@@ -185,20 +192,18 @@ struct ReadCommandTests {
       command: ReadCommand.self,
       arguments: ["TestPeripheral", "--force"],
       success: true,
-      // FIXME: order is backwards
       debugger: """
-        m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
         m[0x0000_0000_0000_1008] -> 0xae64_6aa8
-        m[0x0000_0000_0000_1004] -> 0x6204
-        m[0x0000_0000_0000_1000] -> 0x49fc_e611
+        m[0x0000_0000_0000_1012] -> 0x6204_b303
         """,
       result: """
         TestDevice:
           TestPeripheral:
-            TestRegister0: 0x49fc_e611
-            TestRegister1: 0x6204
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
             TestRegister2: 0xae64_6aa8
-            TestRegister3: 0x7a7e_cbd9
+            TestRegister3: 0x6204_b303
         """)
 
     assertCommand(
@@ -209,20 +214,18 @@ struct ReadCommandTests {
         "--force",
       ],
       success: true,
-      // FIXME: order is backwards
       debugger: """
-        m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
         m[0x0000_0000_0000_1008] -> 0xae64_6aa8
-        m[0x0000_0000_0000_1004] -> 0x6204
-        m[0x0000_0000_0000_1000] -> 0x49fc_e611
+        m[0x0000_0000_0000_1012] -> 0x6204_b303
         """,
       result: """
         TestDevice:
           TestPeripheral:
-            TestRegister0: 0x49fc_e611
-            TestRegister1: 0x6204
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
             TestRegister2: 0xae64_6aa8
-            TestRegister3: 0x7a7e_cbd9
+            TestRegister3: 0x6204_b303
         """)
 
     assertCommand(
@@ -233,24 +236,130 @@ struct ReadCommandTests {
         "--force",
       ],
       success: true,
-      // FIXME: order is backwards
       debugger: """
-        m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1008] -> 0xae64_6aa8
+        m[0x0000_0000_0000_1012] -> 0x6204_b303
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06
+              Field0:      0x3
+            TestRegister1: 0xcbd9
+            TestRegister2: 0xae64_6aa8
+            TestRegister3: 0x6204_b303
+        """)
+  }
+
+  @Test func read_coalesced() {
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral", "--max-gap", "12"],
+      success: true,
+      // Skipped registers with side-effects are not read through.
+      debugger: """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
+            TestRegister2: <skipped>
+            TestRegister3: 0xae64_6aa8
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral", "--max-gap", "12", "--force"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
         m[0x0000_0000_0000_1008] -> 0xae64_6aa8
-        m[0x0000_0000_0000_1004] -> 0x6204
-        m[0x0000_0000_0000_1000] -> 0x49fc_e611
+        m[0x0000_0000_0000_1012] -> 0x6204_b303
         """,
       result: """
         TestDevice:
           TestPeripheral:
-            TestRegister0: 0x49fc_e611
-              Field0:      0x8
-            TestRegister1: 0x6204
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
             TestRegister2: 0xae64_6aa8
-            TestRegister3: 0x7a7e_cbd9
+            TestRegister3: 0x6204_b303
+        """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral", "--max-block", "4"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1004] -> 0xae64
+        m[0x0000_0000_0000_1012] -> 0x6204_b303
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x7a7e_cbd9
+            TestRegister1: 0xae64
+            TestRegister2: <skipped>
+            TestRegister3: 0x6204_b303
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
         """)
   }
 
+  @Test func read_cached() {
+    let context = SVD2LLDB(device: device)
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+
+    func read() {
+      debugger.trace.removeAll()
+      #expect(
+        ReadCommand.run(
+          arguments: ["TestPeripheral", "--force"],
+          debugger: &debugger,
+          result: &result,
+          context: context))
+    }
+
+    // The first read populates the cache.
+    read()
+    #expect(debugger.trace.count == 3)
+
+    // Subsequent reads during the same stop only read registers with
+    // side-effects.
+    read()
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1008] -> 0x49fc_e611
+        """)
+
+    // Resuming the process invalidates the cache.
+    debugger.currentStopID = 1
+    read()
+    #expect(debugger.trace.count == 3)
+
+    // Writing a register invalidates the cache.
+    #expect(
+      WriteCommand.run(
+        arguments: ["TestPeripheral.TestRegister0", "0x1", "--force"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    read()
+    #expect(debugger.trace.count == 3)
+
+    // Values are never cached while the process is running.
+    debugger.currentStopID = nil
+    read()
+    #expect(debugger.trace.count == 3)
+    read()
+    #expect(debugger.trace.count == 3)
+  }
+
   @Test func read_field() {
     assertCommand(
       command: ReadCommand.self,
@@ -301,4 +410,217 @@ struct ReadCommandTests {
               Field1:      0x1
         """)
   }
+
+  @Test func read_pattern() {
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral.TestRegister?"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
+            TestRegister2: <skipped>
+            TestRegister3: 0xae64_6aa8
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["test*.testregister[0..1]"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
+        """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral.TestRegister0.Field*"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> 0x7a7e_cbd9
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x7a7e_cbd9
+              Field0:      0xc
+              Field1:      0x1
+        """)
+
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: ["TestPeripheral.TestRegister[4..9]"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Unknown item “TestPeripheral.TestRegister[4..9]”.
+        """)
+  }
+
+  @Test func read_addressOrder() {
+    assertCommand(
+      command: ReadCommand.self,
+      arguments: [
+        "TestPeripheral.TestRegister3.S",
+        "TestPeripheral.TestRegister3.EN",
+        "TestPeripheral.TestRegister0",
+      ],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        """,
+      result: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x7a7e_cbd9
+            TestRegister3: 0xae64_6aa8
+              EN:          0x0
+              S:           0x1
+        """)
+  }
+
+  /// A variant of the test device whose peripheral only maps its first 16
+  /// bytes, leaving TestRegister3 outside the memory map.
+  static let addressBlockDevice: SVDDevice = {
+    var variant = device
+    variant.peripherals.peripheral[0].addressBlock = [
+      .init(offset: 0, size: 0x10, usage: .registers)
+    ]
+    return variant
+  }()
+
+  @Test func read_addressBlocks() {
+    for force in [false, true] {
+      var debugger = SVD2LLDBTestDebugger()
+      var result = SVD2LLDBTestResult()
+      let success = ReadCommand.run(
+        arguments: ["TestPeripheral"] + (force ? ["--force"] : []),
+        debugger: &debugger,
+        result: &result,
+        context: SVD2LLDB(device: Self.addressBlockDevice))
+      #expect(success)
+      if force {
+        #expect(
+          debugger.description == """
+            m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+            m[0x0000_0000_0000_1008] -> 0xae64_6aa8
+            m[0x0000_0000_0000_1012] -> 0x6204_b303
+            """)
+        assertSVD2LLDBResult(
+          result: result,
+          output: """
+            TestDevice:
+              TestPeripheral:
+                TestRegister0: 0x89fd_6c06
+                TestRegister1: 0xcbd9
+                TestRegister2: 0xae64_6aa8
+                TestRegister3: 0x6204_b303
+            """)
+      } else {
+        #expect(
+          debugger.description == """
+            m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+            """)
+        assertSVD2LLDBResult(
+          result: result,
+          output: """
+            TestDevice:
+              TestPeripheral:
+                TestRegister0: 0x89fd_6c06
+                TestRegister1: 0xcbd9
+                TestRegister2: <skipped>
+                TestRegister3: <unmapped>
+            warning: Skipped registers with side-effects. Use “--force” to read these registers.
+            warning: Skipped registers outside the address blocks of their peripheral. Use “--force” to read these registers.
+            """)
+      }
+    }
+  }
+
+  @Test func read_multipleAddressBlocks() {
+    // Registers in a later address block of their peripheral are mapped.
+    var variant = Self.addressBlockDevice
+    variant.peripherals.peripheral[0].addressBlock?.append(
+      .init(offset: 0x12, size: 0x4, usage: .registers))
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    let success = ReadCommand.run(
+      arguments: ["TestPeripheral"],
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: variant))
+    #expect(success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        """)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x89fd_6c06
+            TestRegister1: 0xcbd9
+            TestRegister2: <skipped>
+            TestRegister3: 0xae64_6aa8
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        """)
+  }
+
+  @Test func render_chunked() {
+    struct Recorder: SVD2LLDBResult {
+      var outputs: [String] = []
+      mutating func output(_ string: String) { self.outputs.append(string) }
+      mutating func warning(_ string: String) {}
+      mutating func error(_ string: String) {}
+    }
+
+    var tree = ValueTree(name: "Device")
+    let peripheral = tree.append(
+      name: "P", key: 0x1000, parent: ValueTree.root)
+    _ = tree.append(name: "B", key: 0x1008, value: .error, parent: peripheral)
+    _ = tree.append(name: "A", key: 0x1004, value: .error, parent: peripheral)
+    _ = tree.append(name: "C", key: 0x1004, value: .error, parent: peripheral)
+
+    var recorder = Recorder()
+    _ = ReadCommand.render(
+      result: &recorder,
+      unknownKeyPaths: [],
+      valueTree: tree,
+      outputChunkSize: 1)
+    #expect(
+      recorder.outputs == [
+        "Device:",
+        "  P:",
+        "    A:  <error>",
+        "    C:  <error>",
+        "    B:  <error>",
+      ])
+
+    recorder = Recorder()
+    _ = ReadCommand.render(
+      result: &recorder,
+      unknownKeyPaths: [],
+      valueTree: tree,
+      outputChunkSize: 20)
+    #expect(
+      recorder.outputs == [
+        "Device:\n  P:\n    A:  <error>",
+        "    C:  <error>\n    B:  <error>",
+      ])
+  }
 }
@@ -0,0 +1,220 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import SVD
+@testable import SVD2LLDB
+
+struct SnapshotCommandTests {
+  @Test func argumentParsing() {
+    assertCommand(
+      command: SnapshotCommand.self,
+      arguments: ["--help"],
+      success: true,
+      debugger: "",
+      result: """
+        OVERVIEW: Save or decode a snapshot of register values.
+
+        USAGE: svd snapshot <action> <path> [<key-path> ...] [--fields]
+
+        ARGUMENTS:
+          <action>                Action to perform. (values: save, decode)
+          <path>                  Path to snapshot file.
+          <key-path>              Key-path to a peripheral, cluster, register, or field.
+
+        OPTIONS:
+          --fields                Include the fields of decoded registers.
+          -h, --help              Show help information.
+
+        """)
+  }
+
+  func temporaryPath() -> String {
+    FileManager.default.temporaryDirectory
+      .appendingPathComponent("\(UUID()).svds").path
+  }
+
+  func run(
+    _ arguments: [String],
+    context: SVD2LLDB,
+    debugger: inout SVD2LLDBTestDebugger
+  ) -> (Bool, SVD2LLDBTestResult) {
+    var result = SVD2LLDBTestResult()
+    let success = SnapshotCommand.run(
+      arguments: arguments,
+      debugger: &debugger,
+      result: &result,
+      context: context)
+    return (success, result)
+  }
+
+  @Test func saveAndDecode() throws {
+    let path = self.temporaryPath()
+    defer { try? FileManager.default.removeItem(atPath: path) }
+    let name = URL(fileURLWithPath: path).lastPathComponent
+
+    // Saving reads every register without side-effects from the target.
+    do {
+      var debugger = SVD2LLDBTestDebugger()
+      let (success, result) = self.run(
+        ["save", path],
+        context: SVD2LLDB(device: device),
+        debugger: &debugger)
+      #expect(success)
+      #expect(
+        debugger.description == """
+          m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+          m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+          """)
+      assertSVD2LLDBResult(
+        result: result,
+        output: """
+          Saved 3 registers to “\(name)”.
+          """)
+    }
+
+    // Decoding does not access the target.
+    do {
+      var debugger = SVD2LLDBTestDebugger()
+      let (success, result) = self.run(
+        ["decode", path],
+        context: SVD2LLDB(device: device),
+        debugger: &debugger)
+      #expect(success)
+      #expect(debugger.trace.isEmpty)
+      assertSVD2LLDBResult(
+        result: result,
+        output: """
+          TestDevice:
+            TestPeripheral:
+              TestRegister0: 0x89fd_6c06
+              TestRegister1: 0xcbd9
+              TestRegister2: <skipped>
+              TestRegister3: 0xae64_6aa8
+          warning: Registers with side-effects are not included in snapshots.
+          """)
+    }
+
+    do {
+      var debugger = SVD2LLDBTestDebugger()
+      let (success, result) = self.run(
+        ["decode", path, "TestPeripheral.TestRegister0", "--fields"],
+        context: SVD2LLDB(device: device),
+        debugger: &debugger)
+      #expect(success)
+      #expect(debugger.trace.isEmpty)
+      assertSVD2LLDBResult(
+        result: result,
+        output: """
+          TestDevice:
+            TestPeripheral:
+              TestRegister0: 0x89fd_6c06
+                Field0:      0x3
+                Field1:      0x0
+          """)
+    }
+  }
+
+  @Test func saveAndDecodeWide() throws {
+    let path = self.temporaryPath()
+    defer { try? FileManager.default.removeItem(atPath: path) }
+    let name = URL(fileURLWithPath: path).lastPathComponent
+    let context = SVD2LLDB(device: DecodeCommandTests.wideDevice)
+
+    // Registers wider than 64 bits are neither read nor saved.
+    do {
+      var debugger = SVD2LLDBTestDebugger()
+      let (success, result) = self.run(
+        ["save", path],
+        context: context,
+        debugger: &debugger)
+      #expect(success)
+      #expect(
+        debugger.description == """
+          m[0x0000_0000_0000_1004] -> 0x7a7e
+          m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+          """)
+      assertSVD2LLDBResult(
+        result: result,
+        output: """
+          Saved 2 registers to “\(name)”.
+          warning: Registers wider than 64 bits are not included in snapshots.
+          """)
+    }
+
+    // Decoding marks them as not captured instead of failing to read them.
+    do {
+      var debugger = SVD2LLDBTestDebugger()
+      let (success, result) = self.run(
+        [
+          "decode", path, "TestPeripheral.TestRegister0",
+          "TestPeripheral.TestRegister1", "--fields",
+        ],
+        context: context,
+        debugger: &debugger)
+      #expect(success)
+      #expect(debugger.trace.isEmpty)
+      assertSVD2LLDBResult(
+        result: result,
+        output: """
+          TestDevice:
+            TestPeripheral:
+              TestRegister0: <not captured>
+                Field0:      <not captured>
+                Field1:      <not captured>
+                Wide:        <not captured>
+              TestRegister1: 0x7a7e
+          warning: Registers wider than 64 bits are not included in snapshots.
+          """)
+    }
+  }
+
+  @Test func decodeErrors() throws {
+    let path = self.temporaryPath()
+    defer { try? FileManager.default.removeItem(atPath: path) }
+
+    var debugger = SVD2LLDBTestDebugger()
+    var (success, result) = self.run(
+      ["decode", path],
+      context: SVD2LLDB(device: device),
+      debugger: &debugger)
+    #expect(!success)
+    #expect(result.error.hasPrefix("error: Failed to read snapshot “\(path)”"))
+
+    try Data("not a snapshot".utf8).write(to: URL(fileURLWithPath: path))
+    (success, result) = self.run(
+      ["decode", path],
+      context: SVD2LLDB(device: device),
+      debugger: &debugger)
+    #expect(!success)
+    #expect(result.error == "error: Invalid snapshot file “\(path)”.")
+
+    // Snapshots only decode with the device they were taken from.
+    var otherDevice = device
+    otherDevice.peripherals.peripheral[0].baseAddress = 0x2000
+    (success, result) = self.run(
+      ["save", path],
+      context: SVD2LLDB(device: otherDevice),
+      debugger: &debugger)
+    #expect(success)
+    (success, result) = self.run(
+      ["decode", path],
+      context: SVD2LLDB(device: device),
+      debugger: &debugger)
+    #expect(!success)
+    #expect(
+      result.error == """
+        error: Snapshot “\(path)” was not taken from device “TestDevice”.
+        """)
+  }
+}
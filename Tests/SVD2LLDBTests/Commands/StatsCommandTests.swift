@@ -0,0 +1,187 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import SVD2LLDB
+
+struct StatsCommandTests {
+  @Test func argumentParsing() {
+    assertCommand(
+      command: StatsCommand.self,
+      arguments: ["--help"],
+      success: true,
+      debugger: "",
+      result: """
+        OVERVIEW: Report where time was spent by recent commands and loads.
+
+        USAGE: svd stats [--last <last>] [--reset] [--trace <path>] [--no-trace]
+
+        OPTIONS:
+          --last <last>           Number of recent commands to report. (default: 1)
+          --reset                 Discard the recorded commands after reporting them.
+          --trace <path>          Append a trace of each command to a file.
+          --no-trace              Stop writing the trace log.
+          -h, --help              Show help information.
+
+        """)
+
+    assertCommand(
+      command: StatsCommand.self,
+      arguments: ["--last", "0"],
+      success: false,
+      debugger: "",
+      result: """
+        usage: svd stats [--last <last>] [--reset] [--trace <path>] [--no-trace]
+        error: Invalid command count “0”, must be between 1 and 16.
+        """)
+
+    assertCommand(
+      command: StatsCommand.self,
+      arguments: ["--trace", "trace.log", "--no-trace"],
+      success: false,
+      debugger: "",
+      result: """
+        usage: svd stats [--last <last>] [--reset] [--trace <path>] [--no-trace]
+        error: Cannot use “--trace” with “--no-trace”.
+        """)
+  }
+
+  @Test func noCommands() {
+    assertCommand(
+      command: StatsCommand.self,
+      arguments: [],
+      success: true,
+      debugger: "",
+      result: """
+        No commands recorded.
+        Loads:
+          testdevice “TestDevice”: 0.000 ms
+          total:       0.000 ms
+        """)
+  }
+
+  /// Returns a context whose clock advances by 1 µs every time it is read.
+  func steppingContext() -> SVD2LLDB {
+    let context = SVD2LLDB(device: device)
+    var time: UInt64 = 0
+    context.statistics.clock = {
+      time += 1_000
+      return time
+    }
+    return context
+  }
+
+  @Test func phases() {
+    let context = self.steppingContext()
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    #expect(
+      ReadCommand.run(
+        arguments: ["TestPeripheral.TestRegister0"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(
+      InfoCommand.run(
+        arguments: ["TestPeripheral"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+
+    result = SVD2LLDBTestResult()
+    #expect(
+      StatsCommand.run(
+        arguments: ["--last", "2", "--reset"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        svd read TestPeripheral.TestRegister0:
+          loading:     0.001 ms
+          resolution:  0.003 ms
+          planning:    0.002 ms
+          memory:      0.001 ms (1 transaction, 4 bytes)
+          rendering:   0.001 ms
+          other:       0.005 ms
+          total:       0.013 ms
+        svd info TestPeripheral:
+          loading:     0.001 ms
+          resolution:  0.003 ms
+          planning:    0.000 ms
+          memory:      0.000 ms (0 transactions, 0 bytes)
+          rendering:   0.001 ms
+          other:       0.004 ms
+          total:       0.009 ms
+        Loads:
+          testdevice “TestDevice”: 0.000 ms
+          total:       0.000 ms
+        """)
+
+    // The recorded commands were discarded.
+    result = SVD2LLDBTestResult()
+    #expect(
+      StatsCommand.run(
+        arguments: [],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(result.output.hasPrefix("No commands recorded."))
+  }
+
+  @Test func trace() throws {
+    let url = FileManager.default.temporaryDirectory
+      .appendingPathComponent("svd2lldb-\(UUID().uuidString).log")
+    defer { try? FileManager.default.removeItem(at: url) }
+
+    let context = self.steppingContext()
+    var debugger = SVD2LLDBTestDebugger()
+    var result = SVD2LLDBTestResult()
+    #expect(
+      StatsCommand.run(
+        arguments: ["--trace", url.path],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(result.output == "Tracing commands to “\(url.path)”.")
+    #expect(
+      ReadCommand.run(
+        arguments: ["TestPeripheral.TestRegister0"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    #expect(
+      StatsCommand.run(
+        arguments: ["--no-trace"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+    // Commands are no longer traced.
+    #expect(
+      ReadCommand.run(
+        arguments: ["TestPeripheral.TestRegister1"],
+        debugger: &debugger,
+        result: &result,
+        context: context))
+
+    let trace = try String(contentsOf: url, encoding: .utf8)
+    #expect(
+      trace == """
+        svd read TestPeripheral.TestRegister0
+          m[0x0000_0000_0000_1000] -> 4 bytes: 0.001 ms
+          total 0.013 ms (loading 0.001 ms, resolution 0.003 ms, planning 0.002 ms, memory 0.001 ms, rendering 0.001 ms), 1 transaction, 4 bytes
+
+        """)
+  }
+}
@@ -0,0 +1,225 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct WatchCommandTests {
+  @Test func argumentParsing() {
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["--help"],
+      success: true,
+      debugger: "",
+      result: """
+        OVERVIEW: Sample registers and decode the fields which changed.
+
+        USAGE: svd watch [<key-path> ...] [--interval <ms>] [--samples <samples>] [--force] [--binary] [--dump]
+
+        ARGUMENTS:
+          <key-path>              Key-path to a peripheral, cluster, register, or field.
+
+        OPTIONS:
+          --interval <ms>         Time to wait between samples. (default: 100)
+          --samples <samples>     Number of samples to take. (default: 1)
+          --force                 Always read ignoring side-effects.
+          --binary                Print table values in binary instead of hexadecimal.
+          --dump                  Print the recorded samples instead of sampling.
+          -h, --help              Show help information.
+
+        """)
+
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: [],
+      success: false,
+      debugger: "",
+      result: """
+        usage: svd watch [<key-path> ...] [--interval <ms>] [--samples <samples>] [--force] [--binary] [--dump]
+        error: Missing expected argument '<key-path> ...'
+        """)
+
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["TestPeripheral", "--samples", "0"],
+      success: false,
+      debugger: "",
+      result: """
+        usage: svd watch [<key-path> ...] [--interval <ms>] [--samples <samples>] [--force] [--binary] [--dump]
+        error: Invalid sample count “0”.
+        """)
+  }
+
+  @Test func badKeyPath() {
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["TestPeripheral.TestRegister[0"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Invalid key path “TestPeripheral.TestRegister[0”.
+        """)
+
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["ABC"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Unknown item “ABC”.
+        """)
+
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["TestPeripheral.TestRegister2"],
+      success: false,
+      debugger: "",
+      result: """
+        warning: Skipped registers with side-effects. Use “--force” to watch these registers.
+        error: No registers to watch.
+        """)
+
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: ["--dump"],
+      success: false,
+      debugger: "",
+      result: """
+        error: No registers are being watched.
+        """)
+  }
+
+  @Test func watch_samples() {
+    assertCommand(
+      command: WatchCommand.self,
+      arguments: [
+        "TestPeripheral.TestRegister0",
+        "TestPeripheral.TestRegister1",
+        "--samples", "3",
+        "--interval", "0",
+      ],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> [0x06 0x6c 0xfd 0x89 0xd9 0xcb]
+        m[0x0000_0000_0000_1000] -> [0x45 0xf9 0x3c 0xcd 0xa8 0x6a]
+        m[0x0000_0000_0000_1000] -> [0x85 0x85 0x8c 0x19 0x03 0xb3]
+        """,
+      result: """
+        Sample 0:
+          TestPeripheral.TestRegister0: 0x89fd_6c06
+          TestPeripheral.TestRegister1: 0xcbd9
+        Sample 1:
+          TestPeripheral.TestRegister0: 0x89fd_6c06 -> 0xcd3c_f945
+            [4:1] Field0 0x2
+          TestPeripheral.TestRegister1: 0xcbd9 -> 0x6aa8
+        Sample 2:
+          TestPeripheral.TestRegister0: 0xcd3c_f945 -> 0x198c_8585
+            [7:7] Field1 0x1
+          TestPeripheral.TestRegister1: 0x6aa8 -> 0xb303
+        """)
+  }
+
+  @Test func watch_stops() {
+    let context = SVD2LLDB(device: device)
+    var debugger = SVD2LLDBTestDebugger()
+
+    func watch(_ arguments: [String], _ expected: String) {
+      var result = SVD2LLDBTestResult()
+      #expect(
+        WatchCommand.run(
+          arguments: arguments,
+          debugger: &debugger,
+          result: &result,
+          context: context))
+      assertSVD2LLDBResult(result: result, output: expected)
+    }
+
+    // Each invocation with the same key paths, such as from a stop hook,
+    // takes one sample of the existing watch and only displays the requested
+    // fields which changed.
+    let keyPath = "TestPeripheral.TestRegister0.Field1"
+    watch(
+      [keyPath],
+      """
+      Sample 0:
+        TestPeripheral.TestRegister0: 0x7a7e_cbd9
+      """)
+    watch(
+      [keyPath],
+      """
+      Sample 1:
+        TestPeripheral.TestRegister0: 0x7a7e_cbd9 -> 0xae64_6aa8
+      """)
+    watch(
+      [keyPath],
+      """
+      Sample 2:
+        TestPeripheral.TestRegister0: 0xae64_6aa8 -> 0x6204_b303
+          [7:7] Field1 0x0
+      """)
+    #expect(debugger.trace.count == 3)
+
+    // The recorded samples can be dumped without accessing the device.
+    watch(
+      ["--dump"],
+      """
+      Sample 0:
+        TestPeripheral.TestRegister0: 0x7a7e_cbd9
+      Sample 1:
+        TestPeripheral.TestRegister0: 0xae64_6aa8
+      Sample 2:
+        TestPeripheral.TestRegister0: 0x6204_b303
+      """)
+    #expect(debugger.trace.count == 3)
+  }
+
+  @Test func watch_addressBlocks() {
+    for force in [false, true] {
+      var debugger = SVD2LLDBTestDebugger()
+      var result = SVD2LLDBTestResult()
+      #expect(
+        WatchCommand.run(
+          arguments: [
+            "TestPeripheral.TestRegister1", "TestPeripheral.TestRegister3",
+          ] + (force ? ["--force"] : []),
+          debugger: &debugger,
+          result: &result,
+          context: SVD2LLDB(device: ReadCommandTests.addressBlockDevice)))
+      if force {
+        #expect(
+          debugger.description == """
+            m[0x0000_0000_0000_1004] -> 0x7a7e
+            m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+            """)
+        assertSVD2LLDBResult(
+          result: result,
+          output: """
+            Sample 0:
+              TestPeripheral.TestRegister1: 0x7a7e
+              TestPeripheral.TestRegister3: 0xae64_6aa8
+            """)
+      } else {
+        #expect(
+          debugger.description == """
+            m[0x0000_0000_0000_1004] -> 0x7a7e
+            """)
+        assertSVD2LLDBResult(
+          result: result,
+          output: """
+            Sample 0:
+              TestPeripheral.TestRegister1: 0x7a7e
+            warning: Skipped registers outside the address blocks of their peripheral. Use “--force” to watch these registers.
+            """)
+      }
+    }
+  }
+}
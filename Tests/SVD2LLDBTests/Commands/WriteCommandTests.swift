@@ -12,6 +12,7 @@
 import MMIOUtilities
 import Testing
 
+@testable import SVD
 @testable import SVD2LLDB
 
 struct WriteCommandTests {
@@ -22,16 +23,16 @@ struct WriteCommandTests {
       success: true,
       debugger: "",
       result: """
-        OVERVIEW: Write a new value to a register.
+        OVERVIEW: Write new values to registers and fields.
 
-        USAGE: svd write <key-path> <value> [--force]
+        USAGE: svd write <assignment> ... [--force] [--dry-run]
 
         ARGUMENTS:
-          <key-path>              Key-path to a register or field.
-          <value>                 Value to write.
+          <assignment>            Register or field assignment, as <key-path>=<value>.
 
         OPTIONS:
           --force                 Always write or modify ignoring side-effects.
+          --dry-run               Print planned transactions without performing them.
           -h, --help              Show help information.
 
         """)
@@ -40,23 +41,21 @@ struct WriteCommandTests {
   @Test func badKeyPath() {
     assertCommand(
       command: WriteCommand.self,
-      // FIXME: remove "--force"
-      arguments: ["", "0", "--force"],
+      arguments: ["", "0"],
       success: false,
       debugger: "",
       result: """
-        usage: svd write <key-path> <value> [--force]
+        usage: svd write <assignment> ... [--force] [--dry-run]
         error: Invalid key path “”.
         """)
 
     assertCommand(
       command: WriteCommand.self,
-      // FIXME: remove "--force"
-      arguments: [".", "0", "--force"],
+      arguments: [".=0"],
       success: false,
       debugger: "",
       result: """
-        usage: svd write <key-path> <value> [--force]
+        usage: svd write <assignment> ... [--force] [--dry-run]
         error: Invalid key path “.”.
         """)
   }
@@ -64,8 +63,7 @@ struct WriteCommandTests {
   @Test func invalidKeyPath() {
     assertCommand(
       command: WriteCommand.self,
-      // FIXME: remove "--force"
-      arguments: ["TestPeripheral", "0", "--force"],
+      arguments: ["TestPeripheral", "0"],
       success: false,
       debugger: "",
       result: """
@@ -74,12 +72,12 @@ struct WriteCommandTests {
 
     assertCommand(
       command: WriteCommand.self,
-      // FIXME: remove "--force"
-      arguments: ["TestPeripheral.TestRegister0.Field0", "0", "--force"],
+      arguments: ["TestPeripheral.TestRegister0"],
       success: false,
       debugger: "",
       result: """
-        error: Invalid register key path “TestPeripheral.TestRegister0.Field0”.
+        usage: svd write <assignment> ... [--force] [--dry-run]
+        error: Missing value for key path “TestPeripheral.TestRegister0”.
         """)
   }
 
@@ -117,6 +115,212 @@ struct WriteCommandTests {
   }
 
   @Test func write_field() {
-    // TODO: implement and test
+    // Writing a field reads and modifies its register.
+    assertCommand(
+      command: WriteCommand.self,
+      arguments: ["TestPeripheral.TestRegister0.Field0=0x3"],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1000] <- 0x7a7e_cbc7
+        """,
+      result: """
+        Wrote: 0x7a7e_cbc7
+        """)
+
+    assertCommand(
+      command: WriteCommand.self,
+      arguments: ["TestPeripheral.TestRegister0.Field1=2"],
+      success: false,
+      debugger: "",
+      result: """
+        error: Invalid value “2“ larger than field size “1“ bit.
+        """)
+  }
+
+  @Test func write_multiple() {
+    // Assignments are grouped by register, each register is read at most once
+    // and written once in address order.
+    assertCommand(
+      command: WriteCommand.self,
+      arguments: [
+        "TestPeripheral.TestRegister3.EN=1",
+        "TestPeripheral.TestRegister0.Field0=0x3",
+        "TestPeripheral.TestRegister1", "0x1234",
+        "TestPeripheral.TestRegister0.Field1=1",
+      ],
+      success: true,
+      debugger: """
+        m[0x0000_0000_0000_1000] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1012] -> 0xae64_6aa8
+        m[0x0000_0000_0000_1000] <- 0x7a7e_cbc7
+        m[0x0000_0000_0000_1004] <- 0x1234
+        m[0x0000_0000_0000_1012] <- 0xae64_6aa9
+        """,
+      result: """
+        Wrote:
+          TestPeripheral.TestRegister0: 0x7a7e_cbc7
+          TestPeripheral.TestRegister1: 0x1234
+          TestPeripheral.TestRegister3: 0xae64_6aa9
+        """)
+  }
+
+  @Test func write_failure() {
+    // A failed write reports the registers already written.
+    var debugger = SVD2LLDBTestDebugger()
+    debugger.failingWrites = [0x1004]
+    var result = SVD2LLDBTestResult()
+    let success = WriteCommand.run(
+      arguments: [
+        "TestPeripheral.TestRegister0=1", "TestPeripheral.TestRegister1=2",
+        "TestPeripheral.TestRegister3=3",
+      ],
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: device))
+    #expect(!success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1000] <- 0x0000_0001
+        """)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        Wrote:
+          TestPeripheral.TestRegister0: 0x0000_0001
+        error: Failed to write register “TestPeripheral.TestRegister1”: \
+        Failed to write memory at 0x0000_0000_0000_1004.
+        """)
+  }
+
+  @Test func write_dryRun() {
+    assertCommand(
+      command: WriteCommand.self,
+      arguments: [
+        "TestPeripheral.TestRegister1=0x1234",
+        "TestPeripheral.TestRegister0.Field0=0x3",
+        "--dry-run",
+      ],
+      success: true,
+      debugger: "",
+      result: """
+        Would write:
+          TestPeripheral.TestRegister0: m[0x0000_0000_0000_1000] <- (m[0x0000_0000_0000_1000] & 0xffff_ffe1) | 0x0000_0006
+          TestPeripheral.TestRegister1: m[0x0000_0000_0000_1004] <- 0x1234
+        """)
+  }
+
+  /// A variant of the test device with read and write side-effects.
+  static let sideEffectsDevice: SVDDevice = {
+    var variant = device
+    variant.peripherals.peripheral[0].registers?.register[0]
+      .modifiedWriteValues = .oneToClear
+    variant.peripherals.peripheral[0].registers?.register[3]
+      .readAction = .clear
+    // RST and EN.
+    variant.peripherals.peripheral[0].registers?.register[3].fields?
+      .field[10].modifiedWriteValues = .zeroToSet
+    variant.peripherals.peripheral[0].registers?.register[3].fields?
+      .field[11].modifiedWriteValues = .oneToClear
+    return variant
+  }()
+
+  func write(
+    _ arguments: [String],
+    debugger: inout SVD2LLDBTestDebugger
+  ) -> (Bool, SVD2LLDBTestResult) {
+    var result = SVD2LLDBTestResult()
+    let success = WriteCommand.run(
+      arguments: arguments,
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: Self.sideEffectsDevice))
+    return (success, result)
+  }
+
+  @Test func write_sideEffects() {
+    // Writing a field of a register where writing one clears bits does not
+    // need to read the register, the other bits are written as zero.
+    var debugger = SVD2LLDBTestDebugger()
+    var (success, result) = self.write(
+      ["TestPeripheral.TestRegister0.Field1=1"],
+      debugger: &debugger)
+    #expect(success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1000] <- 0x0000_0080
+        """)
+    assertSVD2LLDBResult(result: result, output: "Wrote: 0x0000_0080")
+
+    // Modifying a register with read side-effects must be forced.
+    debugger = SVD2LLDBTestDebugger()
+    (success, result) = self.write(
+      ["TestPeripheral.TestRegister3.MODE=1"],
+      debugger: &debugger)
+    #expect(!success)
+    #expect(debugger.trace.isEmpty)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        error: Skipped write of register with side-effects \
+        “TestPeripheral.TestRegister3”. Use “--force” to read and modify this \
+        register.
+        """)
+
+    // Unassigned fields are written back without triggering their write
+    // side-effects: EN is written as zero and RST as one.
+    (success, result) = self.write(
+      ["TestPeripheral.TestRegister3.MODE=1", "--force", "--dry-run"],
+      debugger: &debugger)
+    #expect(success)
+    #expect(debugger.trace.isEmpty)
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        Would write:
+          TestPeripheral.TestRegister3: m[0x0000_0000_0000_1012] <- (m[0x0000_0000_0000_1012] & 0xffff_ff8c) | 0x0000_0012
+        """)
+
+    (success, result) = self.write(
+      ["TestPeripheral.TestRegister3.MODE=1", "--force"],
+      debugger: &debugger)
+    #expect(success)
+    #expect(
+      debugger.description == """
+        m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9
+        m[0x0000_0000_0000_1012] <- 0x7a7e_cb9a
+        """)
+    assertSVD2LLDBResult(result: result, output: "Wrote: 0x7a7e_cb9a")
+  }
+
+  @Test func write_addressBlocks() {
+    // Modifying a register outside the address blocks of its peripheral must
+    // be forced, the read would access unmapped memory.
+    for force in [false, true] {
+      var debugger = SVD2LLDBTestDebugger()
+      var result = SVD2LLDBTestResult()
+      let success = WriteCommand.run(
+        arguments: ["TestPeripheral.TestRegister3.MODE=1"]
+          + (force ? ["--force"] : []),
+        debugger: &debugger,
+        result: &result,
+        context: SVD2LLDB(device: ReadCommandTests.addressBlockDevice))
+      #expect(success == force)
+      if force {
+        #expect(debugger.trace.count == 2)
+        #expect(
+          debugger.description.hasPrefix(
+            "m[0x0000_0000_0000_1012] -> 0x7a7e_cbd9\n"))
+      } else {
+        #expect(debugger.trace.isEmpty)
+        assertSVD2LLDBResult(
+          result: result,
+          output: """
+            error: Skipped write of register outside the address blocks of \
+            its peripheral “TestPeripheral.TestRegister3”. Use “--force” to \
+            read and modify this register.
+            """)
+      }
+    }
   }
 }
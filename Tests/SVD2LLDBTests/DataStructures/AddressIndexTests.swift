@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2LLDB
+
+struct AddressIndexTests {
+  @Test func entries() {
+    var shiftedDevice = device
+    shiftedDevice.peripherals.peripheral[0].baseAddress = 0x1002
+    let devices = [
+      (namespace: "a", index: DeviceIndex(device: device)),
+      (namespace: "b", index: DeviceIndex(device: shiftedDevice)),
+    ]
+    let addressIndex = AddressIndex(devices: devices)
+
+    func keyPaths(_ address: UInt64) -> [String] {
+      addressIndex.entries(containing: address).map { entry in
+        let index = entry.namespace == "a" ? devices[0].index : devices[1].index
+        return "\(entry.namespace):\(index.keyPath(of: entry.node))"
+      }
+    }
+
+    #expect(keyPaths(0x0fff) == [])
+    #expect(keyPaths(0x1000) == ["a:TestPeripheral.TestRegister0"])
+    #expect(
+      keyPaths(0x1003) == [
+        "a:TestPeripheral.TestRegister0",
+        "b:TestPeripheral.TestRegister0",
+      ])
+    #expect(
+      keyPaths(0x1004) == [
+        "b:TestPeripheral.TestRegister0",
+        "a:TestPeripheral.TestRegister1",
+      ])
+    #expect(keyPaths(0x1007) == ["b:TestPeripheral.TestRegister1"])
+    #expect(
+      keyPaths(0x1015) == [
+        "a:TestPeripheral.TestRegister3",
+        "b:TestPeripheral.TestRegister3",
+      ])
+    #expect(keyPaths(0x1018) == [])
+  }
+}
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct CommandStatisticsTests {
+  @Test func format() {
+    #expect(CommandStatistics.format(nanoseconds: 0) == "0.000 ms")
+    #expect(CommandStatistics.format(nanoseconds: 1_234_567) == "1.234 ms")
+    #expect(CommandStatistics.format(nanoseconds: 45_000) == "0.045 ms")
+    #expect(
+      CommandStatistics.format(nanoseconds: 12_000_000_000) == "12000.000 ms")
+  }
+
+  @Test func nestedSpans() {
+    var time: UInt64 = 0
+    let statistics = CommandStatistics { time }
+
+    statistics.beginCommand("svd read A")
+    let planning = statistics.begin(.planning)
+    time += 3
+    // Time spent in nested spans is only attributed to the inner phase.
+    statistics.measure(.memory) { time += 5 }
+    statistics.measure(.memory) { time += 7 }
+    time += 11
+    statistics.end(planning)
+    time += 13
+    statistics.endCommand()
+
+    let record = statistics.records.last
+    #expect(record?.durations == [.planning: 14, .memory: 12])
+    #expect(record?.total == 39)
+
+    // Spans outside of a command are not recorded.
+    statistics.measure(.rendering) { time += 17 }
+    #expect(statistics.records.count == 1)
+  }
+
+  @Test func capacity() {
+    let statistics = CommandStatistics { 0 }
+    for index in 0..<(CommandStatistics.capacity + 2) {
+      statistics.beginCommand("command \(index)")
+      statistics.endCommand()
+    }
+    #expect(statistics.records.count == CommandStatistics.capacity)
+    #expect(statistics.records.first?.command == "command 2")
+
+    statistics.reset()
+    #expect(statistics.records.isEmpty)
+  }
+}
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct CompletionIndexTests {
+  let index = CompletionIndex(paths: [
+    "RCC",
+    "RCC.CR",
+    "RCC.CR.HSION",
+    "RCC.APB1ENR",
+    "RCC.APB1ENR.TIM2EN",
+    "RCC.APB1ENR.TIM3EN",
+    "RCC.APB2ENR",
+    "RCC_ALT",
+    "TIM2",
+    "TIM2.CR1",
+  ])
+
+  @Test func topLevel() {
+    #expect(index.completions(of: "") == ["RCC", "RCC_ALT", "TIM2"])
+    #expect(index.completions(of: "r") == ["RCC", "RCC_ALT"])
+    #expect(index.completions(of: "rcc") == ["RCC", "RCC_ALT"])
+    #expect(index.completions(of: "rcc_") == ["RCC_ALT"])
+  }
+
+  @Test func children() {
+    #expect(
+      index.completions(of: "rcc.") == [
+        "RCC.APB1ENR", "RCC.APB2ENR", "RCC.CR",
+      ])
+    #expect(
+      index.completions(of: "rcc.apb") == [
+        "RCC.APB1ENR", "RCC.APB2ENR",
+      ])
+    #expect(
+      index.completions(of: "rcc.apb1enr.") == [
+        "RCC.APB1ENR.TIM2EN", "RCC.APB1ENR.TIM3EN",
+      ])
+    #expect(index.completions(of: "rcc.apb1enr") == ["RCC.APB1ENR"])
+  }
+
+  @Test func caseInsensitive() {
+    #expect(index.completions(of: "Rcc.Cr.h") == ["RCC.CR.HSION"])
+    #expect(index.completions(of: "RCC.CR.HSION") == ["RCC.CR.HSION"])
+  }
+
+  @Test func noMatch() {
+    #expect(index.completions(of: "uart") == [])
+    #expect(index.completions(of: "rcc.crx") == [])
+    #expect(index.completions(of: "rcc.cr.hsionx") == [])
+  }
+
+  @Test func limit() {
+    #expect(index.completions(of: "rcc.", limit: 2).count == 2)
+  }
+
+  @Test func deviceKeyPaths() {
+    let index = CompletionIndex(device: device)
+    #expect(index.paths.count == 19)
+    #expect(
+      index.completions(of: "testperipheral.testregister0.") == [
+        "TestPeripheral.TestRegister0.Field0",
+        "TestPeripheral.TestRegister0.Field1",
+      ])
+  }
+}
@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2LLDB
+
+struct DeviceIndexTests {
+  static let dimensionDevice = SVDDevice(
+    name: "DimensionDevice",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(size: 32),
+    peripherals: .init(
+      peripheral: [
+        .init(
+          name: "DMA",
+          baseAddress: 0x4000_0000,
+          registers: .init(
+            cluster: [
+              .init(
+                dimensionElement: .init(dim: 4, dimIncrement: 0x10),
+                name: "CH[%s]",
+                description: "A DMA channel",
+                addressOffset: 0x100,
+                register: [
+                  .init(name: "CTRL", addressOffset: 0x0),
+                  .init(
+                    name: "DATA", addressOffset: 0x4, readAction: .clear),
+                ])
+            ],
+            register: [
+              .init(
+                dimensionElement: .init(
+                  dim: 3, dimIncrement: 0x4, dimIndex: "A-C"),
+                name: "FLAG%s",
+                addressOffset: 0x0,
+                fields: .init(
+                  field: [
+                    .init(
+                      dimensionElement: .init(dim: 2, dimIncrement: 8),
+                      name: "EN%s",
+                      bitRange: .lsbMsb(.init(lsb: 0, msb: 1)))
+                  ]))
+            ]))
+      ]))
+
+  let index = DeviceIndex(device: Self.dimensionDevice)
+
+  func keyPaths(_ pattern: String) -> [String] {
+    guard let pattern = KeyPathPattern(pattern) else { return [] }
+    return self.index.nodes(matching: pattern).map {
+      self.index.keyPath(of: $0)
+    }
+  }
+
+  @Test func elementNames() {
+    #expect(
+      DeviceIndex.elementNames(
+        name: "CH[%s]", dimensionElement: .init(dim: 2, dimIncrement: 4))
+        == ["CH[0]", "CH[1]"])
+    #expect(
+      DeviceIndex.elementNames(
+        name: "CH%s",
+        dimensionElement: .init(dim: 3, dimIncrement: 4, dimIndex: "A,B,C"))
+        == ["CHA", "CHB", "CHC"])
+    #expect(
+      DeviceIndex.elementNames(
+        name: "CH%s",
+        dimensionElement: .init(dim: 2, dimIncrement: 4, dimIndex: "3-4"))
+        == ["CH3", "CH4"])
+    #expect(
+      DeviceIndex.elementNames(name: "CH", dimensionElement: nil) == ["CH"])
+  }
+
+  @Test func layout() {
+    // Children of every node are contiguous and refer back to their parent.
+    for node in index.nodes.indices {
+      for child in index.nodes[node].children {
+        #expect(index.nodes[child].parent == node)
+      }
+    }
+    // Device, peripheral, 4 channels with 2 registers each, and 3 flags with
+    // 2 fields each.
+    #expect(index.nodes.count == 1 + 1 + 4 * 3 + 3 * 3)
+  }
+
+  @Test func sortedChildren() {
+    // The sorted children of every node are a permutation of its children
+    // ordered by name.
+    #expect(index.sortedChildren.count == index.nodes.count)
+    for node in index.nodes {
+      let sorted = index.sortedChildren[node.children]
+      #expect(sorted.sorted() == Array(node.children))
+      let names = sorted.map { index.nodes[$0].foldedName }
+      #expect(
+        names == names.sorted { $0.utf8.lexicographicallyPrecedes($1.utf8) })
+    }
+  }
+
+  @Test func expansion() {
+    let channel = index.nodes(matching: KeyPathPattern("dma.ch[2].data")!)
+    #expect(channel.count == 1)
+    #expect(index.nodes[channel[0]].address == 0x4000_0124)
+    #expect(index.nodes[channel[0]].readAction == .clear)
+
+    let field = index.nodes(matching: KeyPathPattern("dma.flagc.en1")!)
+    #expect(field.count == 1)
+    #expect(index.nodes[field[0]].address == 0x4000_0008)
+    #expect(index.nodes[field[0]].bitRange == 8..<10)
+  }
+
+  @Test func patterns() {
+    #expect(
+      keyPaths("dma.ch[1..2].ctrl") == [
+        "DMA.CH[1].CTRL", "DMA.CH[2].CTRL",
+      ])
+    #expect(
+      keyPaths("dma.ch*.c*") == [
+        "DMA.CH[0].CTRL", "DMA.CH[1].CTRL", "DMA.CH[2].CTRL",
+        "DMA.CH[3].CTRL",
+      ])
+    #expect(keyPaths("dma.flag?") == ["DMA.FLAGA", "DMA.FLAGB", "DMA.FLAGC"])
+    #expect(keyPaths("dma.flaga.en[1..9]") == ["DMA.FLAGA.EN1"])
+    #expect(keyPaths("dma.ch[4]") == [])
+    #expect(keyPaths("uart*") == [])
+    // Matches keep the order of the device rather than of the sorted names.
+    #expect(
+      keyPaths("dma.*") == [
+        "DMA.CH[0]", "DMA.CH[1]", "DMA.CH[2]", "DMA.CH[3]", "DMA.FLAGA",
+        "DMA.FLAGB", "DMA.FLAGC",
+      ])
+    #expect(keyPaths("dma.ch[1].*a*") == ["DMA.CH[1].DATA"])
+  }
+
+  @Test func lookup() {
+    let channel = index.node(at: ["dma", "CH[3]", "data"])
+    #expect(channel.map { index.keyPath(of: $0) } == "DMA.CH[3].DATA")
+    #expect(channel.flatMap { index.register(of: $0) }?.name == "DATA")
+    #expect(index.node(at: ["DMA", "CH[3]", "DATA", "EN0"]) == nil)
+    #expect(index.node(at: [String]()) == DeviceIndex.root)
+
+    let flag = index.node(at: ["DMA", "FLAGB"])
+    #expect(flag.map { index.nodes[$0].size } == 32)
+    #expect(flag.flatMap { index.register(of: $0) }?.name == "FLAG%s")
+    #expect(index.node(at: ["DMA"]).flatMap { index.register(of: $0) } == nil)
+    #expect(index.node(at: ["DMA", "FLAG"]) == nil)
+    #expect(index.node(at: ["DMA", "FLAGD"]) == nil)
+    #expect(index.node(at: ["DMA", "A"]) == nil)
+  }
+
+  @Test func addressBlocks() {
+    func peripheral(
+      _ name: String,
+      baseAddress: UInt64,
+      addressBlock: [SVDAddressBlock]?
+    ) -> SVDPeripheral {
+      var peripheral = SVDPeripheral(
+        name: name,
+        baseAddress: baseAddress,
+        registers: .init(
+          register: [
+            .init(name: "CTRL", addressOffset: 0x0),
+            .init(name: "DATA", addressOffset: 0x4),
+          ]))
+      peripheral.addressBlock = addressBlock
+      return peripheral
+    }
+
+    // Devices without address blocks read any gap.
+    #expect(index.unmappedRanges.isEmpty)
+    #expect(index.bufferRanges.isEmpty)
+
+    // Registers in any of the address blocks of a peripheral are mapped, the
+    // gap between the blocks is not.
+    var twoBlocks = peripheral(
+      "E",
+      baseAddress: 0x6000_0000,
+      addressBlock: [
+        .init(offset: 0, size: 0x4, usage: .registers),
+        .init(offset: 0x100, size: 0x4, usage: .registers),
+      ])
+    twoBlocks.registers?.register[1].addressOffset = 0x100
+
+    let device = SVDDevice(
+      name: "AddressBlockDevice",
+      addressUnitBits: 8,
+      width: 32,
+      registerProperties: .init(size: 32),
+      peripherals: .init(
+        peripheral: [
+          peripheral(
+            "A",
+            baseAddress: 0x4000_0000,
+            addressBlock: [.init(offset: 0, size: 0x400, usage: .registers)]),
+          peripheral(
+            "B",
+            baseAddress: 0x4000_1000,
+            addressBlock: [.init(offset: 0, size: 0x100, usage: .buffer)]),
+          peripheral(
+            "C",
+            baseAddress: 0x4000_2000,
+            addressBlock: [.init(offset: 0, size: 0x1000, usage: .reserved)]),
+          peripheral("D", baseAddress: 0x5000_0000, addressBlock: nil),
+          twoBlocks,
+        ]))
+    let blockIndex = DeviceIndex(device: device)
+    let unmapped = blockIndex.unmappedRanges
+    #expect(
+      unmapped == [
+        0x0000_0000..<0x4000_0000,
+        0x4000_0400..<0x4000_1000,
+        0x4000_1100..<0x5000_0000,
+        0x5000_0008..<0x6000_0000,
+        0x6000_0004..<0x6000_0100,
+        0x6000_0104..<UInt64.max,
+      ])
+    #expect(blockIndex.bufferRanges == [0x4000_1000..<0x4000_1100])
+    #expect(!unmapped.mergedRangesOverlap(0x4000_03fc..<0x4000_0400))
+    #expect(unmapped.mergedRangesOverlap(0x4000_03fe..<0x4000_0402))
+    #expect(unmapped.mergedRangesOverlap(0x4000_2000..<0x4000_2004))
+    #expect(!unmapped.mergedRangesOverlap(0x5000_0004..<0x5000_0008))
+    #expect(!unmapped.mergedRangesOverlap(0x6000_0100..<0x6000_0104))
+    #expect(unmapped.mergedRangesOverlap(0x6000_0004..<0x6000_0008))
+  }
+}
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct KeyPathPatternTests {
+  func matches(_ key: String, _ name: String) -> Bool {
+    guard let pattern = KeyPathPattern(key), pattern.keys.count == 1 else {
+      Issue.record("Invalid key “\(key)”")
+      return false
+    }
+    return pattern.keys[0].matches(name.lowercased())
+  }
+
+  @Test func parse() {
+    #expect(KeyPathPattern("") == nil)
+    #expect(KeyPathPattern(".") == nil)
+    #expect(KeyPathPattern("a..b") == nil)
+    #expect(KeyPathPattern("a.ch[0") == nil)
+    #expect(KeyPathPattern("dma.ch[0..7].ctrl")?.keys.count == 3)
+    #expect(
+      KeyPathPattern("UART*.CR?")?.keys == [
+        .init(tokens: [.literal(Array("uart".utf8)), .anyCharacters]),
+        .init(tokens: [.literal(Array("cr".utf8)), .anyCharacter]),
+      ])
+    #expect(KeyPathPattern("Reg")?.keys.first?.literal == "reg")
+  }
+
+  @Test func glob() {
+    #expect(matches("uart*", "UART"))
+    #expect(matches("uart*", "UART10"))
+    #expect(!matches("uart*", "USART1"))
+    #expect(matches("*art*", "USART1"))
+    #expect(matches("cr?", "CR1"))
+    #expect(!matches("cr?", "CR"))
+    #expect(!matches("cr?", "CR10"))
+  }
+
+  @Test func range() {
+    #expect(matches("ch[0..7]", "CH0"))
+    #expect(matches("ch[0..7]", "CH[7]"))
+    #expect(!matches("ch[0..7]", "CH8"))
+    #expect(!matches("ch[0..7]", "CH[10]"))
+    #expect(matches("ch[8..12]", "CH10"))
+    #expect(matches("ch[3]", "CH[3]"))
+    #expect(!matches("ch[3]", "CH[3"))
+    #expect(matches("ch[1..2]_en", "CH2_EN"))
+    #expect(matches("ch[%s]", "CH[%S]"))
+  }
+}
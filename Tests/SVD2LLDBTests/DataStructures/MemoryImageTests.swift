@@ -0,0 +1,131 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import SVD2LLDB
+
+struct MemoryImageTests {
+  /// Writes `bytes` to a temporary file and maps it as a memory image.
+  func image(_ bytes: [UInt8], baseAddress: UInt64?) throws -> MemoryImage {
+    let url = FileManager.default.temporaryDirectory
+      .appendingPathComponent("MemoryImageTests-\(UUID().uuidString)")
+    try Data(bytes).write(to: url)
+    defer { try? FileManager.default.removeItem(at: url) }
+    return try MemoryImage(contentsOf: url, baseAddress: baseAddress)
+  }
+
+  /// Returns a little-endian ELF64 file with a note segment and two loadable
+  /// segments at 0x1000 and 0x1010 containing 8 bytes each.
+  func elfFile(dataEncoding: UInt8 = 1) -> [UInt8] {
+    func bytes(_ value: UInt64, _ count: Int) -> [UInt8] {
+      (0..<count).map { UInt8(truncatingIfNeeded: value >> ($0 * 8)) }
+    }
+    func programHeader(
+      type: UInt64, offset: UInt64, address: UInt64, size: UInt64
+    ) -> [UInt8] {
+      // p_type, p_flags, p_offset, p_vaddr, p_paddr, p_filesz, p_memsz,
+      // p_align.
+      bytes(type, 4) + bytes(4, 4) + bytes(offset, 8) + bytes(address, 8)
+        + bytes(0, 8) + bytes(size, 8) + bytes(size, 8) + bytes(0, 8)
+    }
+    var header: [UInt8] = [0x7f, 0x45, 0x4c, 0x46, 2, dataEncoding, 1]
+    header += [UInt8](repeating: 0, count: 0x20 - header.count)
+    // e_phoff, e_shoff, e_flags, e_ehsize, e_phentsize, e_phnum, and the
+    // section header fields.
+    header += bytes(0x40, 8) + bytes(0, 8) + bytes(0, 4) + bytes(0x40, 2)
+    header += bytes(0x38, 2) + bytes(3, 2) + bytes(0, 6)
+    var file = header
+    file += programHeader(type: 4, offset: 0xe8, address: 0, size: 8)
+    file += programHeader(type: 1, offset: 0xf0, address: 0x1010, size: 8)
+    file += programHeader(type: 1, offset: 0xe8, address: 0x1000, size: 8)
+    file += Array(0x00..<0x08) as [UInt8]
+    file += Array(0x10..<0x18) as [UInt8]
+    return file
+  }
+
+  @Test func raw() throws {
+    let image = try self.image(Array(0..<0x16), baseAddress: 0x1000)
+    #expect(try image.bytes(at: 0x1000, count: 4) == [0x00, 0x01, 0x02, 0x03])
+    #expect(try image.bytes(at: 0x1014, count: 2) == [0x14, 0x15])
+    #expect(throws: (any Error).self) { try image.bytes(at: 0xfff, count: 1) }
+    #expect(throws: (any Error).self) { try image.bytes(at: 0x1014, count: 4) }
+    #expect(throws: (any Error).self) { try image.bytes(at: 0x1016, count: 1) }
+
+    var debugger = MemoryImage.Debugger(image: image)
+    #expect(try debugger.read(address: 0x1004, bits: 16) == 0x0504)
+    #expect(try debugger.read(address: 0x1001, bits: 12) == 0x0201)
+    #expect(
+      try debugger.read(address: 0x1008, bits: 64) == 0x0f0e_0d0c_0b0a_0908)
+    #expect(throws: (any Error).self) {
+      try debugger.write(address: 0x1000, value: 0, bits: 32)
+    }
+  }
+
+  @Test func elf() throws {
+    let image = try self.image(self.elfFile(), baseAddress: nil)
+    #expect(image.segments.map(\.address) == [0x1000, 0x1010])
+    #expect(try image.bytes(at: 0x1004, count: 4) == [0x04, 0x05, 0x06, 0x07])
+    #expect(try image.bytes(at: 0x1012, count: 4) == [0x12, 0x13, 0x14, 0x15])
+    // Bytes between and across segments were not captured.
+    #expect(throws: (any Error).self) { try image.bytes(at: 0x1008, count: 1) }
+    #expect(throws: (any Error).self) { try image.bytes(at: 0x1006, count: 4) }
+
+    // Only little-endian ELF files are supported.
+    #expect(throws: (any Error).self) {
+      try self.image(self.elfFile(dataEncoding: 2), baseAddress: nil)
+    }
+    // Raw images must specify a base address.
+    #expect(throws: (any Error).self) {
+      try self.image(Array(0..<0x16), baseAddress: nil)
+    }
+  }
+
+  @Test func inspector() throws {
+    let inspector = OfflineInspector(device: device)
+    let reports = inspector.run(
+      commands: [["read", "TestPeripheral"], ["write", "TestPeripheral"]],
+      image: try image(Array(0..<0x16), baseAddress: 0x1000))
+    #expect(reports.map(\.success) == [true, false])
+    #expect(
+      reports[0].output == """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x0302_0100
+            TestRegister1: 0x0504
+            TestRegister2: <skipped>
+            TestRegister3: 0x1514_1312
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        """)
+    #expect(
+      reports[1].output == """
+        error: Unknown command “write”. Use “decode”, “info”, or “read”.
+        """)
+
+    // Registers beyond the end of the image fail to read.
+    let truncated = inspector.run(
+      commands: [["read", "TestPeripheral"]],
+      image: try image(Array(0..<0x4), baseAddress: 0x1000))
+    #expect(truncated.map(\.success) == [false])
+    #expect(
+      truncated[0].output == """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x0302_0100
+            TestRegister1: <error>
+            TestRegister2: <skipped>
+            TestRegister3: <error>
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        error: Failed to read some registers.
+        """)
+  }
+}
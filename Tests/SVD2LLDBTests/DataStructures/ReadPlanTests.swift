@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+extension ReadPlan.Transaction: Equatable {}
+
+struct ReadPlanTests {
+  let reads: [ReadPlan.Read] = [
+    .init(address: 0x1010, bits: 32, coalescable: true),
+    .init(address: 0x1000, bits: 32, coalescable: true),
+    .init(address: 0x1004, bits: 16, coalescable: true),
+    .init(address: 0x1008, bits: 32, coalescable: false),
+    .init(address: 0x100c, bits: 32, coalescable: true),
+  ]
+
+  @Test func adjacent() {
+    let plan = ReadPlan(
+      reads: self.reads,
+      options: .init(maximumGap: 0, maximumBlockSize: 1024))
+    #expect(
+      plan.transactions == [
+        .init(address: 0x1000, byteCount: 6, reads: [1, 2]),
+        .init(address: 0x1008, byteCount: 4, reads: [3]),
+        .init(address: 0x100c, byteCount: 8, reads: [4, 0]),
+      ])
+  }
+
+  @Test func gap() {
+    let reads = self.reads.filter(\.coalescable)
+    let plan = ReadPlan(
+      reads: reads,
+      options: .init(maximumGap: 6, maximumBlockSize: 1024))
+    #expect(
+      plan.transactions == [
+        .init(address: 0x1000, byteCount: 0x14, reads: [1, 2, 3, 0])
+      ])
+  }
+
+  @Test func barrier() {
+    let reads = self.reads.filter(\.coalescable)
+    let plan = ReadPlan(
+      reads: reads,
+      barriers: [0x1008..<0x100c],
+      options: .init(maximumGap: 6, maximumBlockSize: 1024))
+    #expect(
+      plan.transactions == [
+        .init(address: 0x1000, byteCount: 6, reads: [1, 2]),
+        .init(address: 0x100c, byteCount: 8, reads: [3, 0]),
+      ])
+  }
+
+  @Test func maximumBlockSize() {
+    let plan = ReadPlan(
+      reads: self.reads,
+      options: .init(maximumGap: 0, maximumBlockSize: 4))
+    #expect(
+      plan.transactions == [
+        .init(address: 0x1000, byteCount: 4, reads: [1]),
+        .init(address: 0x1004, byteCount: 2, reads: [2]),
+        .init(address: 0x1008, byteCount: 4, reads: [3]),
+        .init(address: 0x100c, byteCount: 4, reads: [4]),
+        .init(address: 0x1010, byteCount: 4, reads: [0]),
+      ])
+  }
+
+  @Test func wide() throws {
+    let reads: [ReadPlan.Read] = [
+      .init(address: 0x2000, bits: 128, coalescable: true),
+      .init(address: 0x2010, bits: 32, coalescable: true),
+      .init(address: 0x3000, bits: 96, coalescable: false),
+    ]
+
+    // Wide registers are always read whole, even if larger than a block.
+    #expect(
+      ReadPlan(
+        reads: reads,
+        options: .init(maximumGap: 0, maximumBlockSize: 4)
+      ).transactions == [
+        .init(address: 0x2000, byteCount: 16, reads: [0]),
+        .init(address: 0x2010, byteCount: 4, reads: [1]),
+        .init(address: 0x3000, byteCount: 12, reads: [2]),
+      ])
+
+    let plan = ReadPlan(reads: reads, options: .default)
+    #expect(
+      plan.transactions == [
+        .init(address: 0x2000, byteCount: 20, reads: [0, 1]),
+        .init(address: 0x3000, byteCount: 12, reads: [2]),
+      ])
+
+    // Each transaction is a single block read, including the transaction of
+    // the lone wide register.
+    var debugger = SVD2LLDBTestDebugger()
+    var wideValues: [Int: WideValue] = [:]
+    let values = plan.execute(debugger: &debugger, wideValues: &wideValues)
+    try #require(debugger.trace.count == 2)
+    guard
+      case .readBytes(0x2000, let block) = debugger.trace[0],
+      case .readBytes(0x3000, let bytes) = debugger.trace[1]
+    else {
+      Issue.record("Unexpected transactions: \(debugger)")
+      return
+    }
+    let narrow = block[16..<20].reversed().reduce(0) { $0 << 8 | UInt64($1) }
+    #expect(values == [nil, narrow, nil])
+    #expect(
+      wideValues == [
+        0: WideValue(bytes: block[0..<16], bits: 128),
+        2: WideValue(bytes: bytes, bits: 96),
+      ])
+  }
+}
@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2LLDB
+
+struct RegisterSnapshotTests {
+  let snapshot = RegisterSnapshot(
+    fingerprint: 0x0123_4567_89ab_cdef,
+    values: [0x4000_0004: 0x1234, 0x4000_0000: 0, 0x4000_0100: 0xffff_ffff])
+
+  @Test func values() {
+    #expect(snapshot.addresses == [0x4000_0000, 0x4000_0004, 0x4000_0100])
+    #expect(snapshot.value(at: 0x4000_0004) == 0x1234)
+    #expect(snapshot.value(at: 0x4000_0100) == 0xffff_ffff)
+    #expect(snapshot.value(at: 0x4000_0008) == nil)
+    #expect(snapshot.value(at: 0) == nil)
+    #expect(snapshot.value(at: 0xffff_ffff) == nil)
+  }
+
+  @Test func encoding() {
+    let bytes = snapshot.encoded()
+    #expect(
+      bytes == [
+        // Magic and version.
+        0x53, 0x56, 0x44, 0x53, 0x01,
+        // Fingerprint.
+        0xef, 0xcd, 0xab, 0x89, 0x67, 0x45, 0x23, 0x01,
+        // Count.
+        0x03,
+        // 0x4000_0000: 0x0
+        0x80, 0x80, 0x80, 0x80, 0x04, 0x00,
+        // +0x4: 0x1234
+        0x04, 0xb4, 0x24,
+        // +0xfc: 0xffff_ffff
+        0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0x0f,
+      ])
+
+    let decoded = RegisterSnapshot(bytes: bytes)
+    #expect(decoded?.fingerprint == snapshot.fingerprint)
+    #expect(decoded?.addresses == snapshot.addresses)
+    #expect(decoded?.values == snapshot.values)
+  }
+
+  @Test func invalidEncoding() {
+    let bytes = snapshot.encoded()
+    #expect(RegisterSnapshot(bytes: []) == nil)
+    #expect(RegisterSnapshot(bytes: Array(bytes.dropLast())) == nil)
+    #expect(RegisterSnapshot(bytes: bytes + [0x00]) == nil)
+    var version = bytes
+    version[4] = 0x02
+    #expect(RegisterSnapshot(bytes: version) == nil)
+    // Addresses must be strictly increasing.
+    var duplicate = bytes
+    duplicate[20] = 0x00
+    #expect(RegisterSnapshot(bytes: duplicate) == nil)
+  }
+
+  @Test func differences_sameRegisters() {
+    // Span multiple vectors with a partial vector at the end.
+    let addresses = (0..<19).map { 0x4000_0000 + UInt64($0) * 4 }
+    let old = RegisterSnapshot(
+      fingerprint: 0,
+      values: Dictionary(uniqueKeysWithValues: addresses.map { ($0, $0) }))
+    var new = old
+    for index in [3, 8, 18] {
+      new.values[index] = 0
+    }
+    #expect(RegisterSnapshot.mismatches(old.values, new.values) == [3, 8, 18])
+    #expect(
+      old.differences(to: new) == [
+        .init(address: 0x4000_000c, old: 0x4000_000c, new: 0),
+        .init(address: 0x4000_0020, old: 0x4000_0020, new: 0),
+        .init(address: 0x4000_0048, old: 0x4000_0048, new: 0),
+      ])
+    #expect(old.differences(to: old).isEmpty)
+  }
+
+  @Test func differences_differentRegisters() {
+    let new = RegisterSnapshot(
+      fingerprint: 0x0123_4567_89ab_cdef,
+      values: [0x3000_0000: 1, 0x4000_0004: 0x1234, 0x4000_0100: 0])
+    #expect(
+      snapshot.differences(to: new) == [
+        .init(address: 0x3000_0000, old: nil, new: 1),
+        .init(address: 0x4000_0000, old: 0, new: nil),
+        .init(address: 0x4000_0100, old: 0xffff_ffff, new: 0),
+      ])
+    #expect(
+      new.differences(to: snapshot) == [
+        .init(address: 0x3000_0000, old: 1, new: nil),
+        .init(address: 0x4000_0000, old: nil, new: 0),
+        .init(address: 0x4000_0100, old: 0, new: 0xffff_ffff),
+      ])
+  }
+
+  @Test func fingerprint() {
+    let index = DeviceIndex(device: device)
+    #expect(index.fingerprint == DeviceIndex(device: device).fingerprint)
+
+    var otherDevice = device
+    otherDevice.peripherals.peripheral[0].registers?.register[1].name = "R1"
+    #expect(index.fingerprint != DeviceIndex(device: otherDevice).fingerprint)
+  }
+}
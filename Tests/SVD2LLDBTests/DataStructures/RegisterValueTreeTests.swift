@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct RegisterValueTreeTests {
+  @Test func append() {
+    var tree = ValueTree(name: "Device")
+    #expect(!tree.hasChildren(ValueTree.root))
+    let peripheral = tree.append(name: "Peripheral", parent: ValueTree.root)
+    let b = tree.append(name: "B", value: .data(0x1, 8), parent: peripheral)
+    let a = tree.append(name: "A", value: .skipped, parent: peripheral)
+    let field = tree.append(name: "Field", value: .data(0x0, 1), parent: b)
+    let c = tree.append(name: "C", value: .error, parent: peripheral)
+
+    #expect(tree.count == 6)
+    #expect(tree.parents[field] == b)
+    #expect(Array(tree.children(of: ValueTree.root)) == [peripheral])
+    #expect(Array(tree.children(of: peripheral)) == [b, a, c])
+    #expect(Array(tree.children(of: b)) == [field])
+    #expect(Array(tree.children(of: a)) == [])
+    #expect(
+      tree.description == """
+        Device:
+          Peripheral:
+            B: 0x01
+              Field: 0x0
+            A: <skipped>
+            C: <error>
+
+        """)
+  }
+}
@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct RingBufferTests {
+  @Test func append() {
+    var buffer = RingBuffer<Int>(capacity: 3)
+    #expect(buffer.isEmpty)
+    #expect(buffer.last == nil)
+
+    buffer.append(0)
+    buffer.append(1)
+    #expect(Array(buffer) == [0, 1])
+    #expect(buffer.last == 1)
+
+    // Appending to a full buffer discards the oldest elements.
+    for element in 2..<7 {
+      buffer.append(element)
+    }
+    #expect(buffer.count == 3)
+    #expect(Array(buffer) == [4, 5, 6])
+    #expect(buffer.first == 4)
+    #expect(buffer.last == 6)
+  }
+}
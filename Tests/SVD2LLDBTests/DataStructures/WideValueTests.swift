@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct WideValueTests {
+  @Test func bytes() {
+    let value = WideValue(bytes: (1...12).map { UInt8($0) }, bits: 96)
+    #expect(value.words == [0x0807_0605_0403_0201, 0x0c0b_0a09])
+    #expect(value.description == "0x0c0b_0a09_0807_0605_0403_0201")
+
+    // Bytes and bits beyond the width of the value are ignored.
+    let truncated = WideValue(
+      bytes: [UInt8](repeating: 0xff, count: 16),
+      bits: 68)
+    #expect(truncated.words == [.max, 0xf])
+    #expect(truncated.description == "0xf_ffff_ffff_ffff_ffff")
+  }
+
+  @Test func bits() {
+    let value = WideValue(
+      words: [0x0123_4567_89ab_cdef, 0xfedc_ba98_7654_3210],
+      bits: 128)
+    #expect(value[bits: 0..<4] == 0xf)
+    #expect(value[bits: 56..<72] == 0x1001)
+    #expect(value[bits: 64..<128] == 0xfedc_ba98_7654_3210)
+    #expect(
+      value.slice(bits: 32..<128)
+        == WideValue(words: [0x7654_3210_0123_4567, 0xfedc_ba98], bits: 96))
+  }
+
+  @Test func parsing() {
+    #expect(
+      WideValue(parsing: "0x1_0000_0000_0000_0000", bits: 72)
+        == WideValue(words: [0, 1], bits: 72))
+    #expect(
+      WideValue(parsing: "0x000f", bits: 4)
+        == WideValue(words: [0xf], bits: 4))
+    #expect(WideValue(parsing: "0x00ff", bits: 4) == nil)
+    #expect(WideValue(parsing: "0x", bits: 8) == nil)
+    #expect(WideValue(parsing: "0xg", bits: 8) == nil)
+    #expect(WideValue(parsing: "123", bits: 8) == nil)
+  }
+}
@@ -0,0 +1,239 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct GDBRemoteDebuggerTests {
+  typealias Debugger = GDBRemoteDebugger<GDBRemoteLoopbackStub>
+
+  /// Connects to a stub serving 0x40 bytes counting up from 0 at 0x1000.
+  func debugger(
+    _ options: GDBRemoteLoopbackStub.Options = .init(),
+    maximumOutstandingPackets: Int = 8
+  ) throws -> Debugger {
+    let stub = GDBRemoteLoopbackStub(
+      baseAddress: 0x1000,
+      memory: Array(0..<0x40),
+      options: options)
+    return try Debugger(
+      transport: stub,
+      options: .init(
+        maximumOutstandingPackets: maximumOutstandingPackets,
+        maximumPacketSize: 0x4000))
+  }
+
+  @Test func handshake() throws {
+    var debugger = try self.debugger(.init(packetSize: 0x100))
+    #expect(debugger.connection.packetSize == 0x100)
+    #expect(!debugger.connection.acknowledged)
+    #expect(
+      debugger.connection.transport.requests == [
+        "qSupported", "QStartNoAckMode",
+      ])
+    #expect(debugger.stopID() == nil)
+
+    // The packet size is limited by the options of the connection.
+    let stub = GDBRemoteLoopbackStub(
+      baseAddress: 0, memory: [], options: .init(packetSize: 0x8000))
+    let connection = try GDBRemoteConnection(transport: stub)
+    #expect(connection.packetSize == 0x4000)
+  }
+
+  @Test func read() throws {
+    var debugger = try self.debugger()
+    #expect(try debugger.read(address: 0x1004, bits: 32) == 0x0706_0504)
+    #expect(try debugger.read(address: 0x1001, bits: 12) == 0x0201)
+    #expect(try debugger.read(address: 0x103e, count: 2) == [0x3e, 0x3f])
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "m1004,4", "m1001,2", "m103e,2",
+      ])
+    #expect(throws: (any Error).self) {
+      try debugger.read(address: 0x103e, bits: 32)
+    }
+  }
+
+  @Test func readBlocks() throws {
+    // Responses hold at most (0x14 - 4) / 2 = 8 bytes.
+    var debugger = try self.debugger(.init(packetSize: 0x14))
+    let blocks = try debugger.read(blocks: [
+      (0x1000, 20), (0x1020, 4), (0x2000, 4),
+    ])
+    #expect(blocks == [Array(0..<20), [0x20, 0x21, 0x22, 0x23], nil])
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "m1000,8", "m1008,8", "m1010,4", "m1020,4", "m2000,4",
+      ])
+    // Every packet was sent before waiting for the first response.
+    #expect(debugger.connection.transport.maximumOutstanding == 5)
+
+    // The number of outstanding packets is limited by the options of the
+    // connection.
+    debugger = try self.debugger(
+      .init(packetSize: 0x14),
+      maximumOutstandingPackets: 2)
+    #expect(try debugger.read(blocks: [(0x1000, 20)]) == [Array(0..<20)])
+    #expect(debugger.connection.transport.maximumOutstanding == 2)
+  }
+
+  @Test func memoryResponses() {
+    func memory(_ response: String) -> [UInt8]? {
+      Debugger.memory(Array(response.utf8))
+    }
+    // Error responses and empty responses to unsupported packets are never
+    // decoded as memory, even if they happen to be valid hexadecimal.
+    #expect(memory("") == nil)
+    #expect(memory("E01") == nil)
+    #expect(memory("E.00") == nil)
+    #expect(memory("E.failed") == nil)
+    #expect(memory("0a1b") == [0x0a, 0x1b])
+    #expect(memory("EF01") == [0xef, 0x01])
+  }
+
+  @Test func shortReads() throws {
+    var debugger = try self.debugger(.init(maximumReadSize: 3))
+    #expect(try debugger.read(address: 0x1000, count: 8) == Array(0..<8))
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "m1000,8", "m1003,5", "m1006,2",
+      ])
+  }
+
+  @Test func write() throws {
+    var debugger = try self.debugger()
+    // Bytes with special meanings in packets are escaped.
+    try debugger.write(address: 0x1004, value: 0x2324_7d2a, bits: 32)
+    #expect(debugger.binaryWrites == true)
+    #expect(try debugger.read(address: 0x1004, bits: 32) == 0x2324_7d2a)
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "X1004,4", "m1004,4",
+      ])
+    #expect(throws: (any Error).self) {
+      try debugger.write(address: 0x2000, value: 0, bits: 32)
+    }
+
+    // Stubs without binary writes are written with M packets after the first
+    // X packet is rejected.
+    debugger = try self.debugger(.init(binaryWrites: false))
+    try debugger.write(address: 0x1000, value: 0xabcd, bits: 16)
+    try debugger.write(address: 0x1002, value: 0xef, bits: 8)
+    #expect(debugger.binaryWrites == false)
+    #expect(try debugger.read(address: 0x1000, bits: 24) == 0xef_abcd)
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "X1000,2", "M1000,2", "M1002,1", "m1000,3",
+      ])
+  }
+
+  @Test func acknowledgements() throws {
+    var debugger = try self.debugger(.init(noAckMode: false))
+    #expect(debugger.connection.acknowledged)
+    #expect(debugger.connection.transport.requests == ["qSupported"])
+
+    // Corrupt responses are requested again.
+    debugger.connection.transport.corruptResponses = 1
+    #expect(try debugger.read(address: 0x1000, bits: 16) == 0x0100)
+
+    // Packets are sent one at a time while acknowledgements are enabled.
+    let blocks = try debugger.read(blocks: [(0x1000, 2), (0x1002, 2)])
+    #expect(blocks == [[0x00, 0x01], [0x02, 0x03]])
+    #expect(debugger.connection.transport.maximumOutstanding == 1)
+  }
+
+  @Test func corruptResponse() throws {
+    // Corrupt responses cannot be requested again without acknowledgements.
+    var debugger = try self.debugger()
+    debugger.connection.transport.corruptResponses = 1
+    #expect(throws: (any Error).self) {
+      try debugger.read(address: 0x1000, bits: 16)
+    }
+  }
+
+  @Test func corruptPipelinedResponse() throws {
+    // A corrupt response to the first packet of a pipelined batch leaves the
+    // responses to the other packets in flight.
+    var debugger = try self.debugger()
+    debugger.connection.transport.corruptResponses = 1
+    #expect(throws: (any Error).self) {
+      try debugger.read(blocks: [(0x1000, 4), (0x1004, 4), (0x1008, 4)])
+    }
+    #expect(debugger.connection.failed)
+
+    // Later requests fail without sending anything instead of receiving the
+    // stale responses.
+    #expect(throws: (any Error).self) {
+      try debugger.read(address: 0x100c, bits: 32)
+    }
+    #expect(throws: (any Error).self) {
+      try debugger.read(blocks: [(0x1010, 4)])
+    }
+    #expect(throws: (any Error).self) {
+      try debugger.write(address: 0x1000, value: 0, bits: 32)
+    }
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "m1000,4", "m1004,4", "m1008,4",
+      ])
+
+    // Reads planned after the failed batch are not attempted individually.
+    debugger = try self.debugger()
+    debugger.connection.transport.corruptResponses = 1
+    var result = SVD2LLDBTestResult()
+    let success = ReadCommand.run(
+      arguments: ["TestPeripheral"],
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: device))
+    #expect(!success)
+    #expect(debugger.connection.transport.requests.dropFirst(2) == ["m1000,6"])
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: <error>
+            TestRegister1: <error>
+            TestRegister2: <skipped>
+            TestRegister3: <error>
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        error: Failed to read some registers.
+        """)
+  }
+
+  @Test func readCommand() throws {
+    var debugger = try self.debugger()
+    var result = SVD2LLDBTestResult()
+    let success = ReadCommand.run(
+      arguments: ["TestPeripheral"],
+      debugger: &debugger,
+      result: &result,
+      context: SVD2LLDB(device: device))
+    #expect(success)
+    #expect(
+      debugger.connection.transport.requests.dropFirst(2) == [
+        "m1000,6", "m1012,4",
+      ])
+    assertSVD2LLDBResult(
+      result: result,
+      output: """
+        TestDevice:
+          TestPeripheral:
+            TestRegister0: 0x0302_0100
+            TestRegister1: 0x0504
+            TestRegister2: <skipped>
+            TestRegister3: 0x1514_1312
+        warning: Skipped registers with side-effects. Use “--force” to read these registers.
+        """)
+  }
+}
@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import SVD2LLDB
+
+/// An in-process gdb-remote stub serving a memory image, used in place of a
+/// network connection to a real stub.
+///
+/// Responses are queued as the stub receives requests and are returned one
+/// packet per call to ``receive()``, so the stub can observe how many
+/// requests a client keeps outstanding.
+struct GDBRemoteLoopbackStub {
+  struct Options {
+    var packetSize = 0x100
+    var noAckMode = true
+    var binaryWrites = true
+    /// The most bytes returned by an `m` packet, or `nil` to return all
+    /// requested bytes.
+    var maximumReadSize: Int?
+  }
+
+  var baseAddress: UInt64
+  var memory: [UInt8]
+  var options: Options
+  var acknowledged = true
+  /// The requests received, up to the `:` preceding their data.
+  var requests: [String] = []
+  /// The most responses queued but not yet received by the client.
+  var maximumOutstanding = 0
+  /// The number of upcoming responses to send with an invalid checksum.
+  var corruptResponses = 0
+
+  private var reader = GDBRemotePacketReader()
+  private var queue: [(bytes: [UInt8], response: Bool)] = []
+  private var outstanding = 0
+  private var lastResponse: [UInt8] = []
+}
+
+extension GDBRemoteLoopbackStub {
+  init(baseAddress: UInt64, memory: [UInt8], options: Options = .init()) {
+    self.baseAddress = baseAddress
+    self.memory = memory
+    self.options = options
+  }
+
+  /// Returns the response to a request.
+  mutating func respond(to payload: [UInt8]) -> String {
+    let request = String(decoding: payload, as: UTF8.self)
+    let header = request.prefix { $0 != ":" }
+    self.requests.append(String(header))
+
+    let arguments = header.dropFirst().split(separator: ",").compactMap {
+      Int($0, radix: 16)
+    }
+    let data = payload.drop(while: { $0 != UInt8(ascii: ":") }).dropFirst()
+    switch header.first {
+    case "q" where header == "qSupported":
+      let noAckMode = self.options.noAckMode ? ";QStartNoAckMode+" : ""
+      return "PacketSize=\(String(self.options.packetSize, radix: 16))"
+        + noAckMode
+    case "Q" where header == "QStartNoAckMode":
+      guard self.options.noAckMode else { return "" }
+      self.acknowledged = false
+      return "OK"
+    case "m":
+      guard
+        arguments.count == 2,
+        let range = self.range(address: arguments[0], count: arguments[1])
+      else { return "E01" }
+      let count = min(range.count, self.options.maximumReadSize ?? range.count)
+      let bytes = self.memory[range.prefix(count)]
+      return String(decoding: GDBRemotePacket.hex(bytes), as: UTF8.self)
+    case "M":
+      guard
+        arguments.count == 2,
+        let range = self.range(address: arguments[0], count: arguments[1]),
+        let bytes = GDBRemotePacket.bytes(hex: data),
+        bytes.count == range.count
+      else { return "E01" }
+      self.memory.replaceSubrange(range, with: bytes)
+      return "OK"
+    case "X":
+      guard self.options.binaryWrites else { return "" }
+      guard
+        arguments.count == 2,
+        let range = self.range(address: arguments[0], count: arguments[1]),
+        data.count == range.count
+      else { return "E01" }
+      self.memory.replaceSubrange(range, with: data)
+      return "OK"
+    default:
+      return ""
+    }
+  }
+
+  /// Returns the range of ``memory`` backing an access, or `nil` if the
+  /// access is outside of it.
+  func range(address: Int, count: Int) -> Range<Int>? {
+    let start = address - Int(self.baseAddress)
+    guard start >= 0, start + count <= self.memory.count else { return nil }
+    return start..<start + count
+  }
+
+  mutating func enqueue(response payload: [UInt8]) {
+    self.lastResponse = payload
+    var packet = GDBRemotePacket.frame(payload)
+    if self.corruptResponses > 0 {
+      self.corruptResponses -= 1
+      packet[packet.count - 1] ^= 0x01
+    }
+    self.queue.append((packet, true))
+    self.outstanding += 1
+    self.maximumOutstanding = max(self.maximumOutstanding, self.outstanding)
+  }
+}
+
+extension GDBRemoteLoopbackStub: GDBRemoteTransport {
+  mutating func send(_ bytes: [UInt8]) throws {
+    self.reader.append(bytes)
+    while let event = self.reader.next() {
+      switch event {
+      case .ack:
+        break
+      case .nack:
+        self.enqueue(response: self.lastResponse)
+      case .packet(let payload):
+        if self.acknowledged {
+          self.queue.append(([GDBRemotePacket.ack], false))
+        }
+        self.enqueue(response: Array(self.respond(to: payload).utf8))
+      case .invalidPacket:
+        if self.acknowledged {
+          self.queue.append(([GDBRemotePacket.nack], false))
+        }
+      }
+    }
+  }
+
+  mutating func receive() throws -> [UInt8] {
+    guard !self.queue.isEmpty else {
+      throw GenericError("gdb-remote stub has nothing to send.")
+    }
+    let (bytes, response) = self.queue.removeFirst()
+    if response {
+      self.outstanding -= 1
+    }
+    return bytes
+  }
+}
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD2LLDB
+
+struct GDBRemotePacketTests {
+  @Test func frame() {
+    #expect(
+      GDBRemotePacket.frame(Array("m1000,4".utf8)) == Array("$m1000,4#8e".utf8))
+    #expect(GDBRemotePacket.frame([]) == Array("$#00".utf8))
+  }
+
+  @Test func hex() {
+    #expect(GDBRemotePacket.hex([0x0a, 0xff, 0x00]) == Array("0aff00".utf8))
+    #expect(GDBRemotePacket.bytes(hex: Array("0aFF00".utf8)) == [0x0a, 0xff, 0])
+    // Error responses never decode as bytes.
+    #expect(GDBRemotePacket.bytes(hex: Array("E01".utf8)) == nil)
+    #expect(GDBRemotePacket.bytes(hex: Array("0g".utf8)) == nil)
+  }
+
+  @Test func escaping() {
+    let bytes: [UInt8] = [0x23, 0x24, 0x7d, 0x2a, 0x01]
+    let escaped = GDBRemotePacket.escaped(bytes)
+    #expect(
+      escaped == [0x7d, 0x03, 0x7d, 0x04, 0x7d, 0x5d, 0x7d, 0x0a, 0x01])
+    #expect(GDBRemotePacket.decoded(escaped[...]) == bytes)
+    #expect(GDBRemotePacket.decoded([0x7d][...]) == nil)
+  }
+
+  @Test func runLengthEncoding() {
+    // A space repeats the preceding character 32 - 29 = 3 more times.
+    #expect(
+      GDBRemotePacket.decoded(Array("a0* b".utf8)[...])
+        == Array("a0000b".utf8))
+    #expect(GDBRemotePacket.decoded(Array("* ".utf8)[...]) == nil)
+  }
+
+  @Test func reader() {
+    var reader = GDBRemotePacketReader()
+    #expect(reader.next() == nil)
+
+    // Events are returned once they are complete.
+    reader.append(Array("+-$O".utf8))
+    #expect(reader.next() == .ack)
+    #expect(reader.next() == .nack)
+    #expect(reader.next() == nil)
+    reader.append(Array("K#9".utf8))
+    #expect(reader.next() == nil)
+    reader.append(Array("a".utf8))
+    #expect(reader.next() == .packet(Array("OK".utf8)))
+
+    // Junk and notifications are skipped, run-lengths are expanded.
+    reader.append(Array("\r\n%Stop:T05#99$0* #7a".utf8))
+    #expect(reader.next() == .packet(Array("0000".utf8)))
+
+    // Corrupt packets are reported.
+    reader.append(Array("$OK#00$OK#9a".utf8))
+    #expect(reader.next() == .invalidPacket)
+    #expect(reader.next() == .packet(Array("OK".utf8)))
+    #expect(reader.next() == nil)
+  }
+}
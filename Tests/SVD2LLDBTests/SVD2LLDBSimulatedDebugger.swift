@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import SVD2LLDB
+
+/// A model of the cost of memory transactions over a debug probe.
+///
+/// Each transaction pays a fixed round trip `latency`, covering the debugger,
+/// the gdb-remote connection, and the probe's USB frames, plus the time to
+/// shift every 32-bit word of the transaction over the wire.
+struct SVD2LLDBSimulatedLink {
+  var name: String
+  /// The fixed cost of each transaction in nanoseconds.
+  var latency: UInt64
+  /// The clock frequency of the wire protocol in hertz.
+  var clock: UInt64
+  /// The number of clock cycles needed to transfer one 32-bit word.
+  var cyclesPerWord: UInt64
+}
+
+extension SVD2LLDBSimulatedLink {
+  /// A Serial Wire Debug probe: 8 request, 1 turnaround, 3 acknowledge, 1
+  /// turnaround, 32 data, and 1 parity cycle per word.
+  static func swd(clock: UInt64 = 4_000_000) -> Self {
+    Self(name: "SWD", latency: 1_000_000, clock: clock, cyclesPerWord: 46)
+  }
+
+  /// A JTAG probe: a 35 bit data register scan of the debug port plus the TAP
+  /// state transitions around it per word.
+  static func jtag(clock: UInt64 = 10_000_000) -> Self {
+    Self(name: "JTAG", latency: 1_000_000, clock: clock, cyclesPerWord: 52)
+  }
+
+  /// Returns the time in nanoseconds needed to transfer `bytes` bytes in a
+  /// single transaction.
+  func cost(bytes: Int) -> UInt64 {
+    let words = (UInt64(bytes) + 3) / 4
+    let cycles = words * self.cyclesPerWord
+    return self.latency + cycles * 1_000_000_000 / self.clock
+  }
+}
+
+/// A test debugger which charges each memory transaction against a simulated
+/// debug probe link.
+///
+/// Values are generated and transactions traced by the wrapped
+/// ``SVD2LLDBTestDebugger``.
+struct SVD2LLDBSimulatedDebugger {
+  struct Statistics: Equatable {
+    var reads = 0
+    var writes = 0
+    var bytes = 0
+    /// The simulated time spent in transactions in nanoseconds.
+    var time: UInt64 = 0
+
+    var transactions: Int { self.reads + self.writes }
+  }
+
+  var link: SVD2LLDBSimulatedLink
+  var base: SVD2LLDBTestDebugger
+  var statistics: Statistics
+
+  init(link: SVD2LLDBSimulatedLink) {
+    self.link = link
+    self.base = SVD2LLDBTestDebugger()
+    self.statistics = Statistics()
+  }
+
+  /// Simulates resuming and stopping the target process, which invalidates
+  /// any values cached by the previous stop.
+  mutating func resume() {
+    self.base.currentStopID = (self.base.currentStopID ?? 0) + 1
+  }
+
+  mutating func charge(bytes: Int) {
+    self.statistics.bytes += bytes
+    self.statistics.time += self.link.cost(bytes: bytes)
+  }
+}
+
+extension SVD2LLDBSimulatedDebugger: SVD2LLDBDebugger {
+  mutating func read(
+    address: UInt64,
+    bits: some FixedWidthInteger
+  ) throws -> UInt64 {
+    self.statistics.reads += 1
+    self.charge(bytes: (Int(bits) + 7) / 8)
+    return try self.base.read(address: address, bits: bits)
+  }
+
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    self.statistics.reads += 1
+    self.charge(bytes: count)
+    return try self.base.read(address: address, count: count)
+  }
+
+  mutating func write(
+    address: UInt64,
+    value: UInt64,
+    bits: some FixedWidthInteger
+  ) throws {
+    self.statistics.writes += 1
+    self.charge(bytes: (Int(bits) + 7) / 8)
+    try self.base.write(address: address, value: value, bits: bits)
+  }
+
+  mutating func stopID() -> UInt64? {
+    self.base.stopID()
+  }
+}
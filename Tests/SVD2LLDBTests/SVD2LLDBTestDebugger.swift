@@ -16,12 +16,17 @@ import MMIOUtilities
 struct SVD2LLDBTestDebugger {
   var rng: SVD2LLDBTestPRNG
   var trace: [SVD2LLDBTestDebuggerEvent]
+  var currentStopID: UInt64?
+  /// Addresses at which writes fail.
+  var failingWrites: Set<UInt64>
 }
 
 extension SVD2LLDBTestDebugger {
   init() {
     self.rng = SVD2LLDBTestPRNG(seed: 0)
     self.trace = [SVD2LLDBTestDebuggerEvent]()
+    self.currentStopID = 0
+    self.failingWrites = []
   }
 }
 
@@ -40,44 +45,70 @@ extension SVD2LLDBTestDebugger: SVD2LLDBDebugger {
     let upperBound: UInt64 = 1 << bits
     let value = UInt64.random(in: lowerBound..<upperBound, using: &self.rng)
     self.trace.append(
-      .init(
-        read: true,
+      .read(
         address: address,
         bits: UInt64(bits),
         value: value))
     return value
   }
 
+  mutating func read(
+    address: UInt64,
+    count: Int
+  ) throws -> [UInt8] {
+    var bytes = [UInt8]()
+    bytes.reserveCapacity(count)
+    while bytes.count < count {
+      let value = self.rng.next()
+      for byte in 0..<min(8, count - bytes.count) {
+        bytes.append(UInt8(truncatingIfNeeded: value >> (byte * 8)))
+      }
+    }
+    self.trace.append(.readBytes(address: address, bytes: bytes))
+    return bytes
+  }
+
   mutating func write(
     address: UInt64,
     value: UInt64,
     bits: some FixedWidthInteger
   ) throws {
+    guard !self.failingWrites.contains(address) else {
+      throw GenericError("Failed to write memory at \(hex: address).")
+    }
     self.trace.append(
-      .init(
-        read: false,
+      .write(
         address: address,
         bits: UInt64(bits),
         value: value))
   }
+
+  mutating func stopID() -> UInt64? {
+    self.currentStopID
+  }
 }
 
-struct SVD2LLDBTestDebuggerEvent {
-  var read: Bool
-  var address: UInt64
-  var bits: UInt64
-  var value: UInt64
+enum SVD2LLDBTestDebuggerEvent {
+  case read(address: UInt64, bits: UInt64, value: UInt64)
+  case readBytes(address: UInt64, bytes: [UInt8])
+  case write(address: UInt64, bits: UInt64, value: UInt64)
 }
 
 extension SVD2LLDBTestDebuggerEvent: Equatable {}
 
 extension SVD2LLDBTestDebuggerEvent: CustomStringConvertible {
   var description: String {
-    switch self.read {
-    case true:
-      "m[\(hex: self.address)] -> \(hex: self.value, bits: self.bits)"
-    case false:
-      "m[\(hex: self.address)] <- \(hex: self.value, bits: self.bits)"
+    switch self {
+    case .read(let address, let bits, let value):
+      "m[\(hex: address)] -> \(hex: value, bits: bits)"
+    case .readBytes(let address, let bytes):
+      "m[\(hex: address)] -> [\(Self.description(bytes: bytes))]"
+    case .write(let address, let bits, let value):
+      "m[\(hex: address)] <- \(hex: value, bits: bits)"
     }
   }
+
+  static func description(bytes: [UInt8]) -> String {
+    bytes.lazy.map { "\(hex: $0)" }.joined(separator: " ")
+  }
 }
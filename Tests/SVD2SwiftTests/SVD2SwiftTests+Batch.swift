@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import MMIOUtilities
+import Testing
+
+@testable import SVD2Swift
+
+extension SVD2SwiftTests {
+  @Test func batchManifest_decoding() throws {
+    let manifest = try BatchManifest(
+      data: Data(
+        """
+        {
+          "jobs": [
+            {
+              "input": "Devices/A.svd",
+              "output": "Generated/A",
+              "peripherals": ["UART0"],
+              "access-level": "public",
+              "indent-using-tabs": true,
+              "relocatable": true
+            },
+            {
+              "input": "/absolute/B.svd",
+              "output": "../Generated/B",
+              "namespace-under-device": true,
+              "instance-member-peripherals": true,
+              "device-name": "Custom"
+            }
+          ]
+        }
+        """.utf8),
+      baseDirectory: URL(fileURLWithPath: "/base/manifests"))
+
+    #expect(manifest.jobs.count == 2)
+    #expect(manifest.jobs[0].input == "/base/manifests/Devices/A.svd")
+    #expect(manifest.jobs[0].output == "/base/manifests/Generated/A")
+    #expect(manifest.jobs[1].input == "/absolute/B.svd")
+    #expect(manifest.jobs[1].output == "/base/Generated/B")
+
+    let options0 = manifest.jobs[0].exportOptions
+    #expect(options0.indentation.description == "\t")
+    #expect(options0.accessLevel == .public)
+    #expect(options0.selectedPeripherals == ["UART0"])
+    #expect(!options0.namespaceUnderDevice)
+    #expect(options0.relocatable)
+
+    let options1 = manifest.jobs[1].exportOptions
+    #expect(options1.indentation.description == "    ")
+    #expect(options1.accessLevel == nil)
+    #expect(options1.selectedPeripherals == [])
+    #expect(options1.namespaceUnderDevice)
+    #expect(options1.instanceMemberPeripherals)
+    #expect(options1.overrideDeviceName == "Custom")
+    #expect(!options1.relocatable)
+  }
+
+  @Test func batchManifest_invalidJobs() throws {
+    let invalidJobs = [
+      #"{ "input": "-", "output": "A" }"#,
+      #"{ "input": "A.svd", "output": "-" }"#,
+      #"{ "input": "A.svd", "output": "A", "peripherals": [] }"#,
+      #"{ "input": "A.svd", "output": "A", "#
+        + #""instance-member-peripherals": true }"#,
+      #"{ "input": "A.svd", "output": "A", "namespace-under-device": true, "#
+        + #""instance-member-peripherals": true, "relocatable": true }"#,
+    ]
+    for job in invalidJobs {
+      #expect(throws: SVD2SwiftError.self) {
+        try BatchManifest(
+          data: Data(#"{ "jobs": [\#(job)] }"#.utf8),
+          baseDirectory: URL(fileURLWithPath: "/"))
+      }
+    }
+  }
+
+  @Test(arguments: [1, 3, 64])
+  func concurrentForEach_visitsEachElementOnce(maximumConcurrency: Int) {
+    let elements = Array(0..<100)
+    let visited = Mutex<[Int]>([])
+    concurrentForEach(
+      elements,
+      maximumConcurrency: maximumConcurrency
+    ) { element in
+      visited.withLock { $0.append(element) }
+    }
+    #expect(visited.withLock { $0.sorted() } == elements)
+  }
+}
@@ -0,0 +1,203 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import SVD
+@testable import SVD2Swift
+
+extension SVD2SwiftTests {
+  private static let testDeviceCacheDevice = SVDDevice(
+    name: "ExampleDevice",
+    description: "An example device",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(
+      size: 32,
+      access: .readWrite),
+    peripherals: .init(
+      peripheral: [
+        .init(
+          name: "ExamplePeripheral",
+          description: "An example peripheral",
+          baseAddress: 0x1000,
+          registers: .init(
+            cluster: [],
+            register: [
+              .init(
+                name: "ExampleRegister",
+                description: "An example register",
+                addressOffset: 0x20,
+                fields: .init(field: [
+                  .init(
+                    name: "ExampleField",
+                    bitRange: .lsbMsb(.init(lsb: 4, msb: 10)))
+                ]))
+            ]))
+      ]))
+
+  private static func withTemporaryDirectory<T>(
+    _ body: (String) throws -> T
+  ) throws -> T {
+    let directory = FileManager.default.temporaryDirectory
+      .appendingPathComponent("DeviceCacheTests-\(UUID().uuidString)")
+    defer { try? FileManager.default.removeItem(at: directory) }
+    return try body(directory.path)
+  }
+
+  private static let testDeviceCacheSVD = """
+    <?xml version="1.0" encoding="utf-8"?>
+    <device schemaVersion="1.1">
+      <name>ExampleDevice</name>
+      <description>An example device</description>
+      <addressUnitBits>8</addressUnitBits>
+      <width>32</width>
+      <size>32</size>
+      <access>read-write</access>
+      <peripherals>
+        <peripheral>
+          <name>UART0</name>
+          <description>An example UART</description>
+          <baseAddress>0x40001000</baseAddress>
+          <registers>
+            <register>
+              <name>CTRL</name>
+              <description>Control register</description>
+              <addressOffset>0x4</addressOffset>
+              <fields>
+                <field>
+                  <name>EN</name>
+                  <bitOffset>0</bitOffset>
+                  <bitWidth>1</bitWidth>
+                  <enumeratedValues>
+                    <enumeratedValue>
+                      <name>Disabled</name>
+                      <value>0</value>
+                    </enumeratedValue>
+                    <enumeratedValue>
+                      <name>Enabled</name>
+                      <value>1</value>
+                    </enumeratedValue>
+                  </enumeratedValues>
+                </field>
+              </fields>
+            </register>
+          </registers>
+        </peripheral>
+        <peripheral derivedFrom="UART0">
+          <name>UART1</name>
+          <baseAddress>0x40002000</baseAddress>
+        </peripheral>
+      </peripherals>
+    </device>
+    """
+
+  @Test func deviceCache_key() {
+    let cache = DeviceCache(directory: "", toolDigest: "a")
+    let a = cache.key(for: Data("<device/>".utf8))
+    let b = cache.key(for: Data("<device/>".utf8))
+    let c = cache.key(for: Data("<device />".utf8))
+    #expect(a == b)
+    #expect(a != c)
+
+    // Entries stored by a different build of svd2swift are never reused.
+    let otherTool = DeviceCache(directory: "", toolDigest: "b")
+    #expect(otherTool.key(for: Data("<device/>".utf8)) != a)
+    #expect(DeviceCache.executableDigest != nil)
+  }
+
+  @Test func sha256() {
+    // SHA-256 test vectors from FIPS 180-4, including a message which is
+    // padded into a second block.
+    #expect(
+      SHA256.hexDigest(of: Data())
+        == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855")
+    #expect(
+      SHA256.hexDigest(of: Data("abc".utf8))
+        == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")
+    #expect(
+      SHA256.hexDigest(
+        of: Data(
+          "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq".utf8))
+        == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1")
+  }
+
+  @Test func deviceCache_roundTrip() throws {
+    try Self.withTemporaryDirectory { directory in
+      let cache = DeviceCache(directory: directory, toolDigest: "tool")
+      let data = Data("example".utf8)
+      #expect(cache.load(for: data) == nil)
+
+      cache.store(Self.testDeviceCacheDevice, for: data)
+      #expect(cache.load(for: data) == Self.testDeviceCacheDevice)
+      #expect(cache.load(for: Data("other".utf8)) == nil)
+    }
+  }
+
+  @Test func deviceCache_corruptEntry() throws {
+    try Self.withTemporaryDirectory { directory in
+      let cache = DeviceCache(directory: directory, toolDigest: "tool")
+      let data = Data("example".utf8)
+      cache.store(Self.testDeviceCacheDevice, for: data)
+
+      let entryURL = cache.entryURL(key: cache.key(for: data))
+      try Data("corrupt".utf8).write(to: entryURL)
+      #expect(cache.load(for: data) == nil)
+    }
+  }
+
+  @Test func deviceCache_generatedOutput() throws {
+    try Self.withTemporaryDirectory { directory in
+      let directoryURL = URL(fileURLWithPath: directory)
+      try FileManager.default.createDirectory(
+        at: directoryURL,
+        withIntermediateDirectories: true)
+      let inputURL = directoryURL.appendingPathComponent("Device.svd")
+      try Data(Self.testDeviceCacheSVD.utf8).write(to: inputURL)
+      let cacheDirectory = directoryURL.appendingPathComponent("Cache").path
+
+      func generate(_ name: String, cached: Bool) throws -> [String: Data] {
+        let outputURL = directoryURL.appendingPathComponent(name)
+        var arguments = ["--input", inputURL.path, "--output", outputURL.path]
+        if cached {
+          arguments += ["--cache-directory", cacheDirectory]
+        }
+        try SVD2Swift.parse(arguments).run()
+
+        var files: [String: Data] = [:]
+        let fileNames = try FileManager.default
+          .contentsOfDirectory(atPath: outputURL.path)
+        for fileName in fileNames {
+          files[fileName] = try Data(
+            contentsOf: outputURL.appendingPathComponent(fileName))
+        }
+        return files
+      }
+
+      let uncached = try generate("Uncached", cached: false)
+      #expect(uncached["Device.swift"] != nil)
+      #expect(uncached["UART0.swift"] != nil)
+
+      // The first cached run stores the decoded device and the second loads
+      // it; both must generate byte-identical output to the uncached run.
+      let stored = try generate("Stored", cached: true)
+      let cache = try #require(DeviceCache(directory: cacheDirectory))
+      let key = cache.key(for: Data(Self.testDeviceCacheSVD.utf8))
+      #expect(
+        FileManager.default.fileExists(atPath: cache.entryURL(key: key).path))
+      let loaded = try generate("Loaded", cached: true)
+
+      #expect(stored == uncached)
+      #expect(loaded == uncached)
+    }
+  }
+}
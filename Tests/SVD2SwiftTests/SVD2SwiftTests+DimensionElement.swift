@@ -125,24 +125,8 @@ extension SVD2SwiftTests {
           @Register(bitWidth: 32)
           struct ExampleRegister {
             /// ExampleField
-            @ReadWrite(bits: 2..<4)
-            var examplefield0: ExampleField0
-
-            /// ExampleField
-            @ReadWrite(bits: 7..<9)
-            var examplefield1: ExampleField1
-
-            /// ExampleField
-            @ReadWrite(bits: 12..<14)
-            var examplefield2: ExampleField2
-
-            /// ExampleField
-            @ReadWrite(bits: 17..<19)
-            var examplefield3: ExampleField3
-
-            /// ExampleField
-            @ReadWrite(bits: 22..<24)
-            var examplefield4: ExampleField4
+            @ReadWrite(bits: 2..<4, stride: 5, count: 5)
+            var examplefield: ExampleField
           }
         }
 
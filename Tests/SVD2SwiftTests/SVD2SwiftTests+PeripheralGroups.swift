@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2Swift
+
+extension SVD2SwiftTests {
+  private static let testPeripheralGroupsDevice = SVDDevice(
+    name: "ExampleDevice",
+    description: "An example device",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(
+      size: 32,
+      access: .readWrite),
+    peripherals: .init(
+      peripheral: [
+        .init(
+          name: "UART0",
+          description: "An example UART",
+          baseAddress: 0x4000_0000,
+          registers: .init(
+            cluster: [],
+            register: [
+              .init(
+                name: "ExampleRegister",
+                description: "An example register",
+                addressOffset: 0x20)
+            ])),
+        .init(
+          derivedFrom: "UART0",
+          name: "UART1",
+          description: "An example UART",
+          baseAddress: 0x4000_1000),
+        .init(
+          derivedFrom: "UART0",
+          name: "UART2",
+          description: "An example UART",
+          baseAddress: 0x4000_2000),
+      ]))
+
+  @Test func peripheralGroups_detection() {
+    let peripherals: [SVDPeripheral] = [
+      // Evenly spaced, zero-based instances of a shared type.
+      .init(name: "I2C0", baseAddress: 0x1000),
+      .init(derivedFrom: "I2C0", name: "I2C1", baseAddress: 0x1100),
+      // Not zero-based.
+      .init(name: "SPI1", baseAddress: 0x2000),
+      .init(derivedFrom: "SPI1", name: "SPI2", baseAddress: 0x2100),
+      // Not evenly spaced.
+      .init(name: "TIMER0", baseAddress: 0x3000),
+      .init(derivedFrom: "TIMER0", name: "TIMER1", baseAddress: 0x3100),
+      .init(derivedFrom: "TIMER0", name: "TIMER2", baseAddress: 0x3300),
+      // Distinct types.
+      .init(name: "GPIO0", baseAddress: 0x4000),
+      .init(name: "GPIO1", baseAddress: 0x4100),
+      // Collides with an existing instance name.
+      .init(name: "ADC", baseAddress: 0x5000),
+      .init(name: "ADC_0", baseAddress: 0x5100),
+      .init(derivedFrom: "ADC_0", name: "ADC_1", baseAddress: 0x5200),
+    ]
+
+    let groups = SVDPeripheralGroup.groups(in: peripherals)
+    #expect(groups.map(\.name) == ["i2c"])
+    #expect(groups.first?.typeName == "I2C0")
+    #expect(groups.first?.baseAddress == 0x1000)
+    #expect(groups.first?.stride == 0x100)
+    #expect(groups.first?.count == 2)
+  }
+
+  @Test func peripheralGroups_output() throws {
+    var device = Self.testPeripheralGroupsDevice
+    try device.inflate()
+    var output = Output.inMemory([:])
+    try device.export(with: .testDefault, to: &output)
+    guard case .inMemory(let files) = output else {
+      Issue.record("Expected in memory output")
+      return
+    }
+
+    #expect(
+      files["Device.swift"] == """
+        // Generated by svd2swift.
+
+        import MMIO
+
+        /// An example UART
+        let uart0 = UART0(unsafeAddress: 0x40000000)
+
+        /// An example UART
+        let uart1 = UART1(unsafeAddress: 0x40001000)
+
+        /// An example UART
+        let uart2 = UART2(unsafeAddress: 0x40002000)
+
+        /// UART0 through UART2 indexed by instance number.
+        let uart = RegisterArray<UART0>(unsafeAddress: 0x40000000, stride: 0x1000, count: 3)
+
+        """)
+  }
+}
@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2Swift
+
+extension SVD2SwiftTests {
+  private static let testRelocatableDevice = SVDDevice(
+    name: "ExampleDevice",
+    description: "An example device",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(
+      size: 32,
+      access: .readWrite),
+    peripherals: .init(
+      peripheral: [
+        .init(
+          name: "UART0",
+          description: "An example UART",
+          baseAddress: 0x4000_1000,
+          registers: .init(
+            cluster: [],
+            register: [
+              .init(
+                name: "ExampleRegister",
+                description: "An example register",
+                addressOffset: 0x20)
+            ])),
+        .init(
+          derivedFrom: "UART0",
+          name: "UART1",
+          description: "An example UART",
+          baseAddress: 0x4000_2000),
+        .init(
+          dimensionElement: .init(
+            dim: 2,
+            dimIncrement: 0x100),
+          name: "Timer",
+          description: "An example timer",
+          baseAddress: 0x4000_4000,
+          registers: .init(
+            cluster: [],
+            register: [])),
+      ]))
+
+  @Test func relocatable_output() throws {
+    var options = ExportOptions.testDefault
+    options.relocatable = true
+    var device = Self.testRelocatableDevice
+    try device.inflate()
+    var output = Output.inMemory([:])
+    try device.export(with: options, to: &output)
+    guard case .inMemory(let files) = output else {
+      Issue.record("Expected in memory output")
+      return
+    }
+
+    #expect(
+      files["Device.swift"] == """
+        // Generated by svd2swift.
+
+        import MMIO
+
+        /// An example device
+        ///
+        /// Peripherals are at offsets from 0x40001000.
+        @RegisterBlock
+        struct ExampleDevice {
+          /// An example timer
+          @RegisterBlock(offset: 0x3000, stride: 0x100, count: 2)
+          var timer: RegisterArray<Timer>
+
+          /// An example UART
+          @RegisterBlock(offset: 0x0)
+          var uart0: UART0
+
+          /// An example UART
+          @RegisterBlock(offset: 0x1000)
+          var uart1: UART1
+
+          /// UART0 through UART1 indexed by instance number.
+          @RegisterBlock(offset: 0x0, stride: 0x1000, count: 2)
+          var uart: RegisterArray<UART0>
+        }
+
+        """)
+  }
+
+  @Test func relocatable_selectedPeripherals() throws {
+    // Offsets are relative to the lowest selected peripheral.
+    var options = ExportOptions.testDefault
+    options.relocatable = true
+    options.selectedPeripherals = ["UART1"]
+    var device = Self.testRelocatableDevice
+    try device.inflate()
+    var output = Output.inMemory([:])
+    try device.export(with: options, to: &output)
+    guard case .inMemory(let files) = output else {
+      Issue.record("Expected in memory output")
+      return
+    }
+
+    #expect(
+      files["Device.swift"] == """
+        // Generated by svd2swift.
+
+        import MMIO
+
+        /// An example device
+        ///
+        /// Peripherals are at offsets from 0x40002000.
+        @RegisterBlock
+        struct ExampleDevice {
+          /// An example UART
+          @RegisterBlock(offset: 0x0)
+          var uart1: UART1
+        }
+
+        """)
+  }
+}
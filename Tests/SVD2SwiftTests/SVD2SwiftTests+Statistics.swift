@@ -0,0 +1,170 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift MMIO open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import SVD
+@testable import SVD2Swift
+
+extension SVD2SwiftTests {
+  private static let testStatisticsDevice = SVDDevice(
+    name: "ExampleDevice",
+    description: "An example device",
+    addressUnitBits: 8,
+    width: 32,
+    registerProperties: .init(
+      size: 32,
+      access: .readWrite),
+    peripherals: .init(
+      peripheral: [
+        .init(
+          name: "ExamplePeripheral",
+          description: "An example peripheral",
+          baseAddress: 0x1000,
+          registers: .init(
+            cluster: [
+              .init(
+                name: "ExampleCluster",
+                description: "An example cluster",
+                addressOffset: 0x40,
+                register: [
+                  .init(
+                    name: "ExampleClusterRegister",
+                    addressOffset: 0x0,
+                    fields: .init(field: [
+                      .init(
+                        name: "ExampleClusterField",
+                        bitRange: .lsbMsb(.init(lsb: 0, msb: 1)))
+                    ]))
+                ])
+            ],
+            register: [
+              .init(
+                name: "ExampleRegister",
+                description: "An example register",
+                addressOffset: 0x20,
+                fields: .init(field: [
+                  .init(
+                    name: "A",
+                    bitRange: .lsbMsb(.init(lsb: 2, msb: 6)),
+                    enumeratedValues: .init(
+                      usage: .readWrite,
+                      enumeratedValue: [
+                        .init(data: .value(0x0, mask: .max))
+                      ])),
+                  .init(
+                    name: "B",
+                    bitRange: .lsbMsb(.init(lsb: 8, msb: 9))),
+                  .init(
+                    name: "C",
+                    bitRange: .lsbMsb(.init(lsb: 10, msb: 11)),
+                    enumeratedValues: .init(
+                      usage: .read,
+                      enumeratedValue: [
+                        .init(data: .value(0x0, mask: .max))
+                      ])),
+                ]))
+            ])),
+        .init(
+          derivedFrom: "ExamplePeripheral",
+          name: "ExampleDerivedPeripheral",
+          baseAddress: 0x2000),
+        .init(
+          name: "ExampleOtherPeripheral",
+          baseAddress: 0x3000,
+          registers: .init(
+            cluster: [],
+            register: [
+              .init(
+                name: "ExampleOtherRegister",
+                addressOffset: 0x0)
+            ])),
+      ]))
+
+  private func exportCounts(
+    options: ExportOptions
+  ) throws -> Statistics.Counts {
+    let statistics = Statistics()
+    var device = Self.testStatisticsDevice
+    try device.inflate()
+    var output = Output.inMemory([:])
+    try device.export(with: options, to: &output, statistics: statistics)
+    return statistics.counts
+  }
+
+  @Test func statistics_counts() throws {
+    // Derived peripherals are exported as type aliases, so their registers are
+    // not generated again. Enumerations which cannot be projected are not
+    // generated.
+    var options = ExportOptions.testDefault
+    options.selectedPeripherals = [
+      "ExamplePeripheral", "ExampleDerivedPeripheral",
+    ]
+    let counts = try self.exportCounts(options: options)
+    #expect(counts.peripherals == 2)
+    #expect(counts.registers == 2)
+    #expect(counts.fields == 4)
+    #expect(counts.enumerations == 1)
+
+    let allCounts = try self.exportCounts(options: .testDefault)
+    #expect(allCounts.peripherals == 3)
+    #expect(allCounts.registers == 3)
+    #expect(allCounts.fields == 4)
+    #expect(allCounts.enumerations == 1)
+  }
+
+  @Test func statistics_export() throws {
+    let statistics = Statistics()
+    var device = Self.testStatisticsDevice
+    try device.inflate()
+    var output = Output.inMemory([:])
+    statistics.begin(.export)
+    try device.export(
+      with: .testDefault,
+      to: &output,
+      statistics: statistics)
+    statistics.end()
+
+    guard case .inMemory(let files) = output else {
+      Issue.record("Expected in memory output")
+      return
+    }
+    #expect(statistics.filesGenerated == files.count)
+    let bytes = files.values.reduce(0) { $0 + $1.utf8.count }
+    #expect(statistics.bytesGenerated == bytes)
+    #expect(statistics.phases[.export] != nil)
+    #expect(statistics.phases[.flush] != nil)
+    #expect(statistics.phases[.read] == nil)
+  }
+
+  @Test func statistics_report() throws {
+    let statistics = Statistics()
+    statistics.counts = .init(
+      peripherals: 1,
+      registers: 2,
+      fields: 3,
+      enumerations: 4)
+    statistics.filesGenerated = 5
+    statistics.bytesGenerated = 6
+
+    let text = statistics.report(format: .text)
+    for phase in Statistics.Phase.allCases {
+      #expect(text.contains("  \(phase.rawValue) "))
+    }
+    #expect(text.contains("enumerations:    4\n"))
+    #expect(text.contains("bytes generated: 6\n"))
+
+    let json = statistics.report(format: .json)
+    #expect(json.contains("\"bytesGenerated\" : 6"))
+    #expect(json.contains("\"enumerations\" : 4"))
+    #expect(json.contains("\"wallTimeNanoseconds\" : 0"))
+  }
+}